@@ -0,0 +1,76 @@
+#ifndef BRIDGES_HPP
+#define BRIDGES_HPP
+
+#include <cstdint>
+#include <memory>
+#include <unordered_set>
+#include <vector>
+#include "graph.hpp"
+#include "csr_graph.hpp"
+#include "myDS.hpp"
+
+using namespace MyDataStructures;
+
+/**
+ * @brief Every bridge and articulation point of a graph, with O(1) lookups
+ *
+ * A bridge is an edge whose removal increases the number of connected components; an
+ * articulation point is a vertex whose removal does. Parallel edges are never bridges.
+ */
+struct Biconnectivity
+{
+    vector<Edge> bridges;           // Bridges, oriented from parent to child in the DFS tree
+    vector<int> articulationPoints; // Articulation points, in increasing order
+
+    /**
+     * @brief Check if the edge (u, v) is a bridge (expected O(1))
+     * @param u The first vertex of the edge
+     * @param v The second vertex of the edge
+     * @return true if (u, v) is an edge of the graph and a bridge
+     */
+    bool is_bridge(int u, int v) const { return bridgeKeys.count(key(u, v)) != 0; }
+
+    /**
+     * @brief Check if a vertex is an articulation point (O(1))
+     */
+    bool is_articulation_point(int v) const { return v < static_cast<int>(articulation.size()) && articulation[v]; }
+
+    /**
+     * @brief Key of an unordered pair of vertices
+     */
+    static std::uint64_t key(int u, int v)
+    {
+        if (u > v)
+            std::swap(u, v);
+        return (static_cast<std::uint64_t>(static_cast<std::uint32_t>(u)) << 32) | static_cast<std::uint32_t>(v);
+    }
+
+    std::unordered_set<std::uint64_t> bridgeKeys; // key(u, v) of every bridge
+    vector<bool> articulation;                    // articulation[v] for v in 1 .. n
+};
+
+/**
+ * @brief Find every bridge and articulation point in a single pass
+ * Iterative Tarjan/Hopcroft low-link DFS (an explicit stack instead of recursion), O(n + m).
+ * The parent edge is skipped by edge id, so parallel edges are handled correctly.
+ * @param graph The snapshot to analyze
+ * @return The bridges and articulation points of the graph
+ */
+Biconnectivity find_bridges(const CsrGraph &graph);
+
+/**
+ * @brief Find every bridge and articulation point of a graph in a single pass
+ * @param graph The graph to analyze
+ * @return The bridges and articulation points of the graph
+ */
+Biconnectivity find_bridges(const Graph &graph);
+
+/**
+ * @brief Bridges and articulation points of a graph, computed once per version of the graph
+ * find_bridges and isBridge on a Graph answer from this result until the graph changes.
+ * @param graph The graph to analyze
+ * @return The result, valid even after the graph changes
+ */
+std::shared_ptr<const Biconnectivity> memoized_bridges(const Graph &graph);
+
+#endif // BRIDGES_HPP
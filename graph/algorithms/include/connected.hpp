@@ -7,7 +7,9 @@
 #include "../../data_structure/include/graph.hpp"
 
 /**
- * @brief Checks if an undirected graph is connected using BFS
+ * @brief Checks if an undirected graph is connected using the parallel BFS (ParallelBfs)
+ * The queries on a Graph only see its live vertices: ids left by removeVertex are not isolated
+ * vertices, they are skipped (cuts and separators come back in the ids of the graph).
  * @param graph The graph to check
  * @return true if the graph is connected, false otherwise
  */
@@ -17,19 +19,19 @@ bool is_connected(const Graph& graph);
  * @brief Returns the amount of vertices in the connected component of a given vertex
  * @param graph The graph to check
  * @param v The vertex to check
- * @return The amount of vertices in the connected component of v
+ * @return The amount of vertices in the connected component of v (0 if v is not a live vertex)
  */
 int vertices_amount_in_connected_component(const Graph& graph, int v);
 
 /**
- * @brief Returns the amount of connected components in the graph
+ * @brief Returns the amount of connected components in the graph (see component_labels)
  * @param graph The graph to check
  * @return The amount of connected components in the graph
  */
 int connected_component_amount(const Graph& graph);
 
 /**
- * @brief Checks if an undirected graph is k-edge-connected
+ * @brief Checks if an undirected graph is k-edge-connected, i.e. λ(G) >= k
  * @param graph The graph to check
  * @param k The number of edges to remove
  * @return true if the graph is k-edge-connected, false otherwise
@@ -37,13 +39,65 @@ int connected_component_amount(const Graph& graph);
 bool is_k_edge_connected(Graph& graph, int k);
 
 /**
- * @brief Checks if an undirected graph is k-vertex-connected
+ * @brief Computes the edge connectivity λ(G) and a minimum edge cut
+ * Uses the Nagamochi–Ibaraki contraction algorithm (maximum-adjacency orderings with priorities
+ * capped at the best cut found so far), with no copies of the graph. λ is 0 for graphs with less
+ * than two vertices and for disconnected graphs.
+ * @param graph The graph to check
+ * @return The minimum cut, whose size is λ(G)
+ */
+EdgeCut minimum_edge_cut(const Graph& graph);
+
+/**
+ * @brief Computes the edge connectivity λ(G) and a minimum edge cut of a CSR snapshot
+ * @param graph The snapshot to check
+ * @return The minimum cut, whose size is λ(G)
+ */
+EdgeCut minimum_edge_cut(const CsrGraph& graph);
+
+/**
+ * @brief Computes the edge connectivity λ(G): the fewest edges whose removal disconnects the graph
+ * @param graph The graph to check
+ * @return λ(G)
+ */
+int edge_connectivity(const Graph& graph);
+
+/**
+ * @brief Checks if an undirected graph is k-vertex-connected, i.e. κ(G) >= k
+ * Complete graphs are reported k-vertex-connected for every k.
  * @param graph The graph to check
  * @param k The number of vertices to remove
  * @return true if the graph is k-vertex-connected, false otherwise
  */
 bool is_k_vertex_connected(Graph& graph, int k);
 
+/**
+ * @brief Computes the vertex connectivity κ(G) and a minimum vertex separator
+ * Uses Even's algorithm with the pairs chosen by Esfahanian and Hakimi: unit-capacity maximum
+ * flows on the vertex-split network, one augmenting path at a time found by bidirectional BFS
+ * (FlowNetwork::maxFlowByPaths), from a minimum-degree vertex v to every vertex not adjacent to
+ * it, then between the non-adjacent neighbours of v; n - δ + δ² / 2 flows in total, each capped
+ * at the best separator found so far. Complete graphs have no separator: κ is n - 1
+ * and the separator is empty. κ is 0 for disconnected graphs.
+ * @param graph The graph to check
+ * @return The minimum separator, whose size is κ(G)
+ */
+VertexCut minimum_vertex_separator(const Graph& graph);
+
+/**
+ * @brief Computes the vertex connectivity κ(G) and a minimum vertex separator of a CSR snapshot
+ * @param graph The snapshot to check
+ * @return The minimum separator, whose size is κ(G)
+ */
+VertexCut minimum_vertex_separator(const CsrGraph& graph);
+
+/**
+ * @brief Computes the vertex connectivity κ(G): the fewest vertices whose removal disconnects the graph
+ * @param graph The graph to check
+ * @return κ(G)
+ */
+int vertex_connectivity(const Graph& graph);
+
 /**
  * @brief Checks if an undirected graph is a forest
  * @param graph The graph to check
@@ -51,4 +105,139 @@ bool is_k_vertex_connected(Graph& graph, int k);
  */
 bool is_forest(Graph& graph);
 
+/**
+ * @brief Checks if a CSR snapshot is connected using the parallel BFS (ParallelBfs)
+ * @param graph The snapshot to check
+ * @return true if the graph is connected, false otherwise
+ */
+bool is_connected(const CsrGraph& graph);
+
+/**
+ * @brief Returns the amount of vertices in the connected component of a given vertex
+ * @param graph The snapshot to check
+ * @param v The vertex to check
+ * @return The amount of vertices in the connected component of v (0 if v is not a vertex)
+ */
+int vertices_amount_in_connected_component(const CsrGraph& graph, int v);
+
+/**
+ * @brief Returns the amount of connected components in a CSR snapshot (see component_labels)
+ * @param graph The snapshot to check
+ * @return The amount of connected components in the graph
+ */
+int connected_component_amount(const CsrGraph& graph);
+
+/**
+ * @brief Checks if a CSR snapshot is k-edge-connected, i.e. λ(G) >= k
+ * @param graph The snapshot to check
+ * @param k The number of edges to remove
+ * @return true if the graph is k-edge-connected, false otherwise
+ */
+bool is_k_edge_connected(const CsrGraph& graph, int k);
+
+/**
+ * @brief Checks if a CSR snapshot is k-vertex-connected, i.e. κ(G) >= k
+ * Complete graphs are reported k-vertex-connected for every k.
+ * @param graph The snapshot to check
+ * @param k The number of vertices to remove
+ * @return true if the graph is k-vertex-connected, false otherwise
+ */
+bool is_k_vertex_connected(const CsrGraph& graph, int k);
+
+/**
+ * @brief Checks if every pair of distinct vertices is adjacent, in O(n + m)
+ * Parallel edges and self-loops are ignored, so a multigraph with n(n-1)/2 edges is not
+ * necessarily complete. Graphs with less than two vertices are complete.
+ * @param graph The snapshot to check
+ * @return true if the graph is complete, false otherwise
+ */
+bool is_complete(const CsrGraph& graph);
+
+/**
+ * @brief Checks if every pair of distinct vertices is adjacent (see is_complete of CsrGraph)
+ * @param graph The graph to check
+ * @return true if the graph is complete, false otherwise
+ */
+bool is_complete(const Graph& graph);
+
+/**
+ * @brief Checks if a CSR snapshot is a forest
+ * Parallel edges and self-loops count as cycles.
+ * @param graph The snapshot to check
+ * @return true if the graph is a forest, false otherwise (means it has cycles)
+ */
+bool is_forest(const CsrGraph& graph);
+
+/**
+ * @brief Labels the connected components of an undirected graph in parallel
+ * Afforest: every vertex is first linked to its first two neighbours in a concurrent union-find,
+ * a sample of vertices then finds the largest component, and only the vertices outside it link
+ * their remaining edges. On graphs with a giant component most edges are never looked at.
+ * @param graph The graph to label
+ * @param threads Number of threads (0 = get_thread_count())
+ * @return Per-vertex component ids, number of components and their sizes
+ */
+ComponentLabels component_labels(const Graph& graph, int threads = 0);
+
+/**
+ * @brief Component labels of a graph, computed once per version of the graph (see Graph::memoize)
+ * is_connected, connected_component_amount, vertices_amount_in_connected_component, is_forest and
+ * component_labels on a Graph all answer from these labels, so only the first call after a change
+ * labels the graph. Removed vertices get label -1 and belong to no component.
+ * @param graph The graph to label
+ * @return The labels, valid even after the graph changes
+ */
+std::shared_ptr<const ComponentLabels> memoized_component_labels(const Graph& graph);
+
+/**
+ * @brief Labels the connected components of an undirected CSR snapshot in parallel
+ * @param graph The snapshot to label
+ * @param threads Number of threads (0 = get_thread_count())
+ * @return Per-vertex component ids, number of components and their sizes
+ */
+ComponentLabels component_labels(const CsrGraph& graph, int threads = 0);
+
+/**
+ * @brief Checks if a labeled graph is connected, in O(1)
+ * @param components Result of component_labels
+ * @return true if the graph is connected, false otherwise
+ */
+inline bool is_connected(const ComponentLabels& components)
+{
+    return components.connected();
+}
+
+/**
+ * @brief Returns the amount of vertices in the connected component of a given vertex, in O(1)
+ * @param components Result of component_labels
+ * @param v The vertex to check
+ * @return The amount of vertices in the connected component of v (0 if v is not a vertex)
+ */
+inline int vertices_amount_in_connected_component(const ComponentLabels& components, int v)
+{
+    return components.component_size(v);
+}
+
+/**
+ * @brief Returns the amount of connected components of a labeled graph, in O(1)
+ * @param components Result of component_labels
+ * @return The amount of connected components in the graph
+ */
+inline int connected_component_amount(const ComponentLabels& components)
+{
+    return components.count;
+}
+
+/**
+ * @brief Checks if a labeled graph is a forest, in O(1): a forest with c components has n - c edges
+ * @param components Result of component_labels of a graph without removed vertices
+ * @param edges Number of edges of the labeled graph
+ * @return true if the graph is a forest, false otherwise (means it has cycles)
+ */
+inline bool is_forest(const ComponentLabels& components, int edges)
+{
+    int n = static_cast<int>(components.label.size()) - 1;
+    return edges == n - components.count;
+}
+
 #endif // GRAPH_CONNECTED_HPP
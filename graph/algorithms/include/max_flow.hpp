@@ -0,0 +1,66 @@
+#ifndef MAX_FLOW_HPP
+#define MAX_FLOW_HPP
+
+#include <climits>
+#include <vector>
+
+/**
+ * @brief Flow network solved by augmenting paths found with a bidirectional BFS
+ *
+ * Nodes are numbered 0 .. size-1. Arcs are stored in pairs: arc i and its residual
+ * partner i ^ 1. The original capacities are kept, so the same network can be solved
+ * for many (source, sink) pairs with reset() in between. Resets only touch the arcs the
+ * previous flow used.
+ */
+class FlowNetwork
+{
+public:
+    /**
+     * @brief Create a network without arcs
+     * @param nodes Number of nodes
+     */
+    explicit FlowNetwork(int nodes);
+
+    /**
+     * @brief Add an arc from -> to
+     * @return Index of the arc (its residual partner is index ^ 1)
+     */
+    int addArc(int from, int to, int capacity);
+
+    /**
+     * @brief Compute a maximum flow one augmenting path at a time, stopping early at a limit
+     *
+     * Each path is found with a bidirectional BFS in the residual network, which only explores
+     * the neighbourhoods of the source and the sink while they are small, so small limits on
+     * large networks (e.g. connectivity checks) stay cheap.
+     * @param source Source node
+     * @param sink Sink node
+     * @param limit The flow is not pushed beyond this value
+     * @return Value of the flow found (at most limit)
+     */
+    int maxFlowByPaths(int source, int sink, int limit);
+
+    /**
+     * @brief Restore every arc used by the last flows to its original capacity
+     */
+    void reset();
+
+    /**
+     * @brief Nodes reachable from the source in the residual network of the last flow
+     * After a maximum flow these nodes form the source side of a minimum cut.
+     */
+    std::vector<bool> sourceSide(int source) const;
+
+private:
+    std::vector<int> head;        // First arc leaving each node (-1 if none)
+    std::vector<int> nextArc;     // Next arc leaving the same node
+    std::vector<int> to;          // Head of each arc
+    std::vector<int> capacity;    // Residual capacity of each arc
+    std::vector<int> original;    // Capacity the arc was created with
+    std::vector<int> touched;     // Arcs whose capacity changed since the last reset
+    std::vector<int> mark;        // Search stamp of each node in maxFlowByPaths
+    std::vector<int> via;         // Arc that links each node to its search tree
+    int searchStamp;
+};
+
+#endif // MAX_FLOW_HPP
@@ -14,6 +14,19 @@ using namespace MyDataStructures;
 //print the mst
 void print_mst(const std::vector<Edge>& mst);
 
+/**
+ * @brief Total order used to sort edges in every Kruskal variant: weight, then u, then v
+ * Ties are broken the same way everywhere, so all variants return the same tree.
+ */
+inline bool edge_less(const Edge& a, const Edge& b)
+{
+    if (a.weight != b.weight)
+        return a.weight < b.weight;
+    if (a.u != b.u)
+        return a.u < b.u;
+    return a.v < b.v;
+}
+
 /**
  * @brief Finds the minimum spanning tree of a graph using Kruskal's algorithm
  * @param graph The input graph
@@ -30,6 +43,7 @@ vector<Edge> kruskal_mst_paint(const Graph& graph);
 
 /**
  * @brief Finds the minimum spanning tree of a graph using Kruskal's algorithm
+ * Computed once per version of the graph (see Graph::memoize); later calls copy the result.
  * @param graph The input graph
  * @return A vector of edges representing the minimum spanning tree
  */
@@ -43,10 +57,90 @@ vector<Edge> kruskal_mst(const Graph& graph);
 vector<Edge> prim_mst_naive(const Graph& graph);
 
 /**
- * @brief Finds the minimum spanning tree of a graph using Prim's algorithm
+ * @brief Finds the minimum spanning forest of a graph using Prim's algorithm
+ * The frontier is an indexed 4-ary heap with decrease-key (one entry per vertex), O(m log n).
+ * A new tree is grown from every vertex not reached by the previous ones.
  * @param graph The input graph
- * @return A vector of edges representing the minimum spanning tree
+ * @return A vector of edges representing the minimum spanning forest
  */
 vector<Edge> prim_mst(const Graph& graph);
 
+/**
+ * @brief Finds the minimum spanning forest of a graph using Prim's algorithm with a lazy heap
+ * The frontier is a binary heap of edges; edges leading into the tree are discarded when
+ * popped instead of being removed, O(m log m).
+ * @param graph The input graph
+ * @return A vector of edges representing the minimum spanning forest
+ */
+vector<Edge> prim_mst_lazy(const Graph& graph);
+
+/**
+ * @brief Finds the minimum spanning tree of a CSR snapshot using Kruskal's algorithm
+ * Edges are collected and sorted in parallel (get_thread_count() threads).
+ * @param graph The input snapshot
+ * @return A vector of edges representing the minimum spanning tree
+ */
+vector<Edge> kruskal_mst(const CsrGraph& graph);
+
+/**
+ * @brief Finds the minimum spanning forest of a graph using Filter-Kruskal
+ * Edges are partitioned around a sampled pivot weight; the lighter half is solved first and
+ * the heavier half is then filtered, dropping edges whose endpoints are already connected,
+ * so most heavy edges are never sorted. Partitioning, filtering and the sorts of small
+ * ranges run in parallel. Returns the same edges, in the same order, as kruskal_mst.
+ * @param graph The input graph
+ * @param threads Number of threads (0 = get_thread_count())
+ * @return A vector of edges representing the minimum spanning forest
+ */
+vector<Edge> filter_kruskal_mst(const Graph& graph, int threads = 0);
+
+/**
+ * @brief Finds the minimum spanning forest of a CSR snapshot using Filter-Kruskal
+ * @param graph The input snapshot
+ * @param threads Number of threads (0 = get_thread_count())
+ * @return A vector of edges representing the minimum spanning forest
+ */
+vector<Edge> filter_kruskal_mst(const CsrGraph& graph, int threads = 0);
+
+/**
+ * @brief Finds the minimum spanning forest of a graph using Borůvka's algorithm in parallel
+ * Each round finds the cheapest edge leaving every component (in the edge_less order) with all
+ * threads scanning disjoint ranges of vertices, then contracts the components joined by those
+ * edges in a ConcurrentUnionFind, also in parallel. O(log n) rounds of O(m / threads) work. The forest is returned sorted by edge_less, so
+ * it is identical to the result of kruskal_mst.
+ * @param graph The input graph
+ * @param threads Number of threads (0 = get_thread_count())
+ * @return A vector of edges representing the minimum spanning forest
+ */
+vector<Edge> boruvka_mst(const Graph& graph, int threads = 0);
+
+/**
+ * @brief Finds the minimum spanning forest of a CSR snapshot using Borůvka's algorithm in parallel
+ * @param graph The input snapshot
+ * @param threads Number of threads (0 = get_thread_count())
+ * @return A vector of edges representing the minimum spanning forest
+ */
+vector<Edge> boruvka_mst(const CsrGraph& graph, int threads = 0);
+
+/**
+ * @brief Finds the minimum spanning tree of a CSR snapshot using Prim's algorithm
+ * @param graph The input snapshot
+ * @return A vector of edges representing the minimum spanning tree
+ */
+vector<Edge> prim_mst_naive(const CsrGraph& graph);
+
+/**
+ * @brief Finds the minimum spanning forest of a CSR snapshot using Prim's algorithm (indexed heap)
+ * @param graph The input snapshot
+ * @return A vector of edges representing the minimum spanning forest
+ */
+vector<Edge> prim_mst(const CsrGraph& graph);
+
+/**
+ * @brief Finds the minimum spanning forest of a CSR snapshot using Prim's algorithm (lazy heap)
+ * @param graph The input snapshot
+ * @return A vector of edges representing the minimum spanning forest
+ */
+vector<Edge> prim_mst_lazy(const CsrGraph& graph);
+
 #endif // MINIMUM_SPANNING_TREE_HPP
@@ -0,0 +1,129 @@
+#ifndef PARALLEL_HPP
+#define PARALLEL_HPP
+
+#include <algorithm>
+#include <cstddef>
+#include <thread>
+#include <vector>
+#include "metrics.hpp"
+
+/**
+ * @brief Number of threads used by parallel algorithms when a call does not choose one
+ * Defaults to the GRAPH_THREADS environment variable, or to the number of hardware threads.
+ */
+int get_thread_count();
+
+/**
+ * @brief Change the default number of threads of parallel algorithms
+ * @param threads Number of threads, or 0 to go back to the default
+ */
+void set_thread_count(int threads);
+
+/**
+ * @brief Turn a per-call thread count into an actual one (0 means get_thread_count())
+ */
+inline int resolve_thread_count(int threads)
+{
+    return threads > 0 ? threads : get_thread_count();
+}
+
+/**
+ * @brief Split [begin, end) into one contiguous chunk per thread and run body on each chunk
+ * body(chunkBegin, chunkEnd, thread) runs on the calling thread for thread 0. Small ranges
+ * (fewer than minimumChunk items per thread) use fewer threads.
+ * @param begin First index
+ * @param end One past the last index
+ * @param threads Number of threads (0 = get_thread_count())
+ * @param body Work for one chunk
+ * @param minimumChunk Smallest chunk worth a thread of its own
+ */
+template <typename Body>
+void parallel_for(std::size_t begin, std::size_t end, int threads, Body body, std::size_t minimumChunk = 4096)
+{
+    if (begin >= end)
+        return;
+    std::size_t count = end - begin;
+    std::size_t workers = static_cast<std::size_t>(resolve_thread_count(threads));
+    workers = std::max<std::size_t>(1, std::min(workers, count / std::max<std::size_t>(minimumChunk, 1)));
+    if (workers == 1)
+    {
+        body(begin, end, 0);
+        return;
+    }
+
+    std::size_t chunk = (count + workers - 1) / workers;
+    std::vector<std::thread> pool;
+    pool.reserve(workers - 1);
+#if GRAPH_METRICS
+    // O trabalho contado pelas threads auxiliares passa para a thread que chamou (e para os seus escopos)
+    std::vector<GraphMetrics::CounterValues> handed(workers);
+#endif
+    for (std::size_t t = 1; t < workers; ++t)
+    {
+        std::size_t first = begin + t * chunk;
+        if (first >= end)
+            break;
+#if GRAPH_METRICS
+        pool.emplace_back([body, first, last = std::min(end, first + chunk), t, &handed]() mutable {
+            body(first, last, static_cast<int>(t));
+            GraphMetrics::hand_over(handed[t]);
+        });
+#else
+        pool.emplace_back(body, first, std::min(end, first + chunk), static_cast<int>(t));
+#endif
+    }
+    body(begin, std::min(end, begin + chunk), 0);
+    for (std::thread &worker : pool)
+        worker.join();
+#if GRAPH_METRICS
+    for (std::size_t t = 1; t <= pool.size(); ++t)
+        GraphMetrics::take_over(handed[t]);
+#endif
+}
+
+/**
+ * @brief Sort a vector with several threads: chunks are sorted in parallel, then merged in pairs
+ * @param data The vector to sort
+ * @param less Strict weak ordering
+ * @param threads Number of threads (0 = get_thread_count())
+ */
+template <typename T, typename Compare>
+void parallel_sort(std::vector<T> &data, Compare less, int threads = 0)
+{
+    const std::size_t minimumChunk = 1 << 14;
+    std::size_t workers = static_cast<std::size_t>(resolve_thread_count(threads));
+    workers = std::min(workers, data.size() / minimumChunk);
+    if (workers <= 1)
+    {
+        std::sort(data.begin(), data.end(), less);
+        return;
+    }
+
+    // Limites dos pedacos: pedaco t ocupa [bounds[t], bounds[t + 1])
+    std::vector<std::size_t> bounds(workers + 1);
+    for (std::size_t t = 0; t <= workers; ++t)
+        bounds[t] = data.size() * t / workers;
+    parallel_for(0, workers, static_cast<int>(workers), [&](std::size_t first, std::size_t last, int) {
+        for (std::size_t t = first; t < last; ++t)
+            std::sort(data.begin() + bounds[t], data.begin() + bounds[t + 1], less);
+    }, 1);
+
+    // Intercala pares de pedacos vizinhos, dobrando a largura a cada rodada
+    for (std::size_t width = 1; width < workers; width *= 2)
+    {
+        std::size_t pairs = (workers + 2 * width - 1) / (2 * width);
+        parallel_for(0, pairs, static_cast<int>(pairs), [&](std::size_t first, std::size_t last, int) {
+            for (std::size_t p = first; p < last; ++p)
+            {
+                std::size_t left = p * 2 * width;
+                std::size_t middle = std::min(left + width, workers);
+                std::size_t right = std::min(left + 2 * width, workers);
+                if (middle < right)
+                    std::inplace_merge(data.begin() + bounds[left], data.begin() + bounds[middle],
+                                       data.begin() + bounds[right], less);
+            }
+        }, 1);
+    }
+}
+
+#endif // PARALLEL_HPP
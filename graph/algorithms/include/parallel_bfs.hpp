@@ -0,0 +1,94 @@
+#ifndef PARALLEL_BFS_HPP
+#define PARALLEL_BFS_HPP
+
+#include <atomic>
+#include <cstdint>
+#include <vector>
+#include "csr_graph.hpp"
+
+/**
+ * @brief Direction-optimizing breadth-first search (Beamer et al.) shared by the connectivity checks
+ *
+ * Each level is expanded either top-down (the frontier is a vertex list split between threads,
+ * which claim new vertices in an atomic visited bitmap and collect them in per-thread queues) or
+ * bottom-up (every unvisited vertex looks for a neighbour in the frontier bitmap and stops at the
+ * first one). The search switches to bottom-up when the edges leaving the frontier outnumber
+ * the unexplored edges / ALPHA, and back to top-down when the frontier shrinks under n / BETA.
+ * On low-diameter graphs the few huge middle levels are then done bottom-up, checking a small
+ * part of their edges.
+ *
+ * The visited marks are kept between runs, so sweeping all components costs O(n + m) in total.
+ * Directed snapshots are always searched top-down.
+ */
+class ParallelBfs
+{
+public:
+    static const int ALPHA = 14;
+    static const int BETA = 24;
+
+    /**
+     * @brief Prepare a search over a snapshot (nothing visited yet)
+     * @param graph The snapshot to search (shared, not copied)
+     * @param threads Number of threads (0 = get_thread_count())
+     */
+    explicit ParallelBfs(const CsrGraph &graph, int threads = 0);
+
+    /**
+     * @brief Visit every vertex reachable from a source without crossing visited vertices
+     * @param source The source vertex; nothing happens if it is already visited
+     * @return Number of vertices visited by this run, source included
+     */
+    int run(int source);
+
+    /**
+     * @brief Mark a vertex as visited without searching from it, so later runs go around it
+     */
+    void block(int vertex);
+
+    /**
+     * @brief Check if a vertex was visited (or blocked)
+     */
+    bool visited(int vertex) const
+    {
+        return (visitedBits[vertex >> 6].load(std::memory_order_relaxed) >> (vertex & 63)) & 1;
+    }
+
+    /**
+     * @brief Distance to a vertex from the source of the run that visited it, -1 if not visited
+     */
+    int level(int vertex) const { return depth[vertex]; }
+
+    /**
+     * @brief Forget every visited mark
+     */
+    void clear();
+
+private:
+    using Bitmap = std::vector<std::atomic<std::uint64_t>>;
+
+    void topDownStep(int nextLevel, std::int64_t &found, std::int64_t &foundSlots);
+    void bottomUpStep(int nextLevel, std::int64_t &found, std::int64_t &foundSlots);
+    void queueToBitmap();
+    void bitmapToQueue();
+
+    static bool claim(Bitmap &bits, int vertex);
+    static bool test(const Bitmap &bits, int vertex)
+    {
+        return (bits[vertex >> 6].load(std::memory_order_relaxed) >> (vertex & 63)) & 1;
+    }
+    void zero(Bitmap &bits);
+
+    CsrGraph graph;
+    int threads;
+    Bitmap visitedBits;
+    Bitmap frontierBits;              // Frontier while going bottom-up
+    Bitmap nextBits;
+    std::vector<int> depth;
+    std::vector<int> frontier;        // Frontier while going top-down
+    std::vector<std::vector<int>> localQueues;     // One per thread
+    std::vector<std::int64_t> localFound;          // Vertices found by each thread in a step
+    std::vector<std::int64_t> localSlots;          // Their half-edges
+    std::int64_t unexploredSlots;     // Half-edges of the vertices not visited yet
+};
+
+#endif // PARALLEL_BFS_HPP
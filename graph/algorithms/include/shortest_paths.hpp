@@ -0,0 +1,76 @@
+#ifndef SHORTEST_PATHS_HPP
+#define SHORTEST_PATHS_HPP
+
+#include <cstdint>
+#include <vector>
+#include "graph.hpp"
+#include "csr_graph.hpp"
+#include "myDS.hpp"
+
+using namespace MyDataStructures;
+
+/**
+ * @brief Result of a single-source shortest path search
+ */
+struct ShortestPaths
+{
+    static constexpr std::int64_t UNREACHABLE = INT64_MAX;
+
+    int source;                   // Vertex the search started from
+    vector<std::int64_t> distance; // distance[v], or UNREACHABLE (index 0 unused)
+    vector<int> predecessor;      // Vertex before v in a shortest path, 0 for the source and unreached vertices
+
+    /**
+     * @brief Check if a vertex was reached by the search (false for ids outside 1..n)
+     */
+    bool reached(int v) const { return v >= 1 && v < static_cast<int>(distance.size()) && distance[v] != UNREACHABLE; }
+
+    /**
+     * @brief Rebuild the shortest path to a vertex from the predecessors
+     * @param v The last vertex of the path
+     * @return The vertices from the source to v, or an empty vector if v was not reached or is
+     * not a vertex
+     */
+    vector<int> path_to(int v) const;
+};
+
+/**
+ * @brief Dijkstra's algorithm from one source to every vertex
+ * Uses an indexed 4-ary heap with decrease-key, so the extra memory is O(n) whatever the
+ * number of edges. Weights must be non-negative. Directed snapshots (CsrGraph::arcs) are
+ * searched along their arcs.
+ * @param graph The snapshot to search
+ * @param source The source vertex
+ * @return Distances and predecessors of every vertex
+ */
+ShortestPaths dijkstra(const CsrGraph &graph, int source);
+
+/**
+ * @brief Dijkstra's algorithm from a source to a target, stopping as soon as the target is settled
+ * Distances and predecessors are final for the vertices settled before the target (which
+ * include every vertex on the returned path); the others may hold upper bounds.
+ * @param graph The snapshot to search
+ * @param source The source vertex
+ * @param target The target vertex
+ * @return Distances and predecessors; use path_to(target) for the path
+ */
+ShortestPaths dijkstra(const CsrGraph &graph, int source, int target);
+
+/**
+ * @brief Dijkstra's algorithm from one source to every vertex of a graph
+ * @param graph The graph to search
+ * @param source The source vertex
+ * @return Distances and predecessors of every vertex
+ */
+ShortestPaths dijkstra(const Graph &graph, int source);
+
+/**
+ * @brief Dijkstra's algorithm from a source to a target of a graph, stopping at the target
+ * @param graph The graph to search
+ * @param source The source vertex
+ * @param target The target vertex
+ * @return Distances and predecessors; use path_to(target) for the path
+ */
+ShortestPaths dijkstra(const Graph &graph, int source, int target);
+
+#endif // SHORTEST_PATHS_HPP
@@ -3,17 +3,35 @@
 
 #include <iostream>
 #include "graph.hpp"
+#include "csr_graph.hpp"
 #include "myDS.hpp"
 #include "utils.hpp"
 using namespace MyDataStructures;
 
+/**
+ * @brief Algorithms available to build an Eulerian trail
+ */
+enum class EulerianTrailAlgorithm
+{
+    Fleury,    // Removes one non-bridge edge at a time; O(m² (n + m)), kept for comparison
+    Hierholzer // Splices closed sub-trails together; O(n + m)
+};
+
 /**
  * @brief Function to get the Eulerian properties of a graph
+ * Computed once per version of the graph (see Graph::memoize).
  * @param graph The graph to analyze
  * @return An EulerianTrailProperties struct containing the "eulerian properties" of the graph
  */
 EulerianTrailProperties getEulerianPropetiesOfGraph(const Graph &graph);
 
+/**
+ * @brief Get the Eulerian properties of a CSR snapshot
+ * @param graph The snapshot to analyze
+ * @return An EulerianTrailProperties struct containing the "eulerian properties" of the graph
+ */
+EulerianTrailProperties getEulerianPropetiesOfGraph(const CsrGraph &graph);
+
 /**
  * @brief Fleury's algorithm to find an Eulerian trail in a graph
  * @param graph The graph to analyze
@@ -22,5 +40,33 @@ EulerianTrailProperties getEulerianPropetiesOfGraph(const Graph &graph);
  */
 vector<Edge> fleury_algorithm(const Graph &graph, EulerianTrailProperties &properties);
 
+/**
+ * @brief Hierholzer's algorithm to find an Eulerian trail in a graph
+ * Iterative (an explicit stack instead of recursion), with one edge cursor per vertex and a
+ * used-edge bitmap, so every edge is looked at a constant number of times.
+ * @param graph The graph to analyze
+ * @param properties The EulerianTrailProperties struct containing the "eulerian properties" of the graph
+ * @return A vector of edges representing the Eulerian trail (empty if the graph is not Eulerian)
+ */
+vector<Edge> hierholzer_algorithm(const Graph &graph, EulerianTrailProperties &properties);
+
+/**
+ * @brief Hierholzer's algorithm on a CSR snapshot
+ * @param graph The snapshot to analyze
+ * @param properties The "eulerian properties" of the graph
+ * @return A vector of edges representing the Eulerian trail (empty if the graph is not Eulerian)
+ */
+vector<Edge> hierholzer_algorithm(const CsrGraph &graph, const EulerianTrailProperties &properties);
+
+/**
+ * @brief Find an Eulerian trail with the chosen algorithm
+ * @param graph The graph to analyze
+ * @param properties The "eulerian properties" of the graph
+ * @param algorithm Fleury or Hierholzer
+ * @return A vector of edges representing the Eulerian trail
+ */
+vector<Edge> eulerian_trail(const Graph &graph, EulerianTrailProperties &properties,
+                            EulerianTrailAlgorithm algorithm = EulerianTrailAlgorithm::Hierholzer);
+
 #endif // TRACKS_HPP
 
@@ -10,6 +10,8 @@
 using namespace MyDataStructures;
 
 /** @brief Performs a breadth-first search (BFS) on the graph starting from a given vertex.
+ * Runs the direction-optimizing ParallelBfs on a snapshot of the graph; vertices already
+ * marked in visited are not crossed.
  * @param graph The graph to traverse.
  * @param vertice The starting vertex for the BFS.
  * @param visited A vector to keep track of visited vertices.
@@ -23,14 +25,31 @@ void bfs(const Graph &graph, int vertice, vector<bool> &visited);
  */
 void dfs(const Graph &graph, int vertice, vector<bool> &visited);
 
+/** @brief Performs a breadth-first search (BFS) on a CSR snapshot starting from a given vertex.
+ * Runs the direction-optimizing ParallelBfs; vertices already marked in visited are not crossed.
+ * @param graph The snapshot to traverse.
+ * @param vertice The starting vertex for the BFS.
+ * @param visited A vector to keep track of visited vertices.
+ */
+void bfs(const CsrGraph &graph, int vertice, vector<bool> &visited);
+
+/** @brief Performs a depth-first search (DFS) on a CSR snapshot starting from a given vertex.
+ * @param graph The snapshot to traverse.
+ * @param vertice The starting vertex for the DFS.
+ * @param visited A vector to keep track of visited vertices.
+ */
+void dfs(const CsrGraph &graph, int vertice, vector<bool> &visited);
+
 /** @brief Checks if an edge (u, v) is a bridge in the graph.
  * A bridge is an edge whose removal increases the number of connected components in the graph.
+ * The graph is not modified; each call runs a full low-link pass, so callers that probe many
+ * edges should call find_bridges once and use Biconnectivity::is_bridge.
  * @param graph The graph to check.
  * @param u The first vertex of the edge.
  * @param v The second vertex of the edge.
  * @return true if the edge (u, v) is a bridge, false otherwise.
  */
-bool isBridge(Graph &graph, int u, int v);
+bool isBridge(const Graph &graph, int u, int v);
 
 
 
@@ -0,0 +1,98 @@
+#include "bridges.hpp"
+#include "metrics.hpp"
+#include <algorithm>
+
+Biconnectivity find_bridges(const CsrGraph &graph)
+{
+    GRAPH_METRICS_SCOPE("find_bridges");
+    int n = graph.getOrder();
+    // A DFS visita cada vertice e examina cada meia-aresta uma vez
+    GRAPH_METRICS_ADD(VerticesTouched, n);
+    GRAPH_METRICS_ADD(EdgesTouched, 2 * static_cast<uint64_t>(graph.getSize()));
+    Biconnectivity result;
+    result.articulation.assign(n + 1, false);
+
+    vector<int> discovery(n + 1, 0); // Ordem de descoberta na DFS (0 = nao visitado)
+    vector<int> low(n + 1, 0);       // Menor ordem alcancavel pela subarvore com uma aresta de retorno
+    int timer = 0;
+
+    // Pilha da DFS: vertice, proxima meia-aresta a examinar e meia-aresta que veio do pai
+    struct Frame
+    {
+        int vertex;
+        uint64_t next;
+        uint64_t parentSlot;
+    };
+    const uint64_t NO_SLOT = UINT64_MAX;
+    vector<Frame> stack;
+
+    for (int root = 1; root <= n; ++root)
+    {
+        if (discovery[root] != 0)
+            continue;
+        discovery[root] = low[root] = ++timer;
+        stack.push_back({root, graph.edgeBegin(root), NO_SLOT});
+        int rootChildren = 0;
+
+        while (!stack.empty())
+        {
+            Frame &frame = stack.back();
+            int v = frame.vertex;
+            if (frame.next < graph.edgeEnd(v))
+            {
+                uint64_t slot = frame.next++;
+                // So a propria aresta do pai e ignorada: arestas paralelas contam como retorno
+                if (frame.parentSlot != NO_SLOT && graph.edgeId(slot) == graph.edgeId(frame.parentSlot))
+                    continue;
+                int w = graph.target(slot);
+                if (discovery[w] == 0)
+                {
+                    discovery[w] = low[w] = ++timer;
+                    if (v == root)
+                        ++rootChildren;
+                    stack.push_back({w, graph.edgeBegin(w), slot}); // frame deixa de ser valido
+                }
+                else
+                {
+                    low[v] = min(low[v], discovery[w]);
+                }
+                continue;
+            }
+
+            // Subarvore de v terminada: propaga low para o pai
+            uint64_t parentSlot = frame.parentSlot;
+            stack.pop_back();
+            if (stack.empty())
+                break;
+            int parent = stack.back().vertex;
+            low[parent] = min(low[parent], low[v]);
+            if (low[v] > discovery[parent])
+            {
+                result.bridges.push_back(Edge(parent, v, graph.weight(parentSlot)));
+                result.bridgeKeys.insert(Biconnectivity::key(parent, v));
+            }
+            if (parent != root && low[v] >= discovery[parent])
+                result.articulation[parent] = true;
+        }
+        if (rootChildren > 1)
+            result.articulation[root] = true;
+    }
+
+    for (int v = 1; v <= n; ++v)
+    {
+        if (result.articulation[v])
+            result.articulationPoints.push_back(v);
+    }
+    return result;
+}
+
+Biconnectivity find_bridges(const Graph &graph)
+{
+    GRAPH_METRICS_SCOPE("find_bridges");
+    return *memoized_bridges(graph);
+}
+
+std::shared_ptr<const Biconnectivity> memoized_bridges(const Graph &graph)
+{
+    return graph.memoize<Biconnectivity>(DerivedProperty::Bridges, [&graph]() { return find_bridges(graph.freeze()); });
+}
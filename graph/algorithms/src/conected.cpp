@@ -1,247 +1,730 @@
 #include "graph.hpp"
 #include <queue>
 #include "connected.hpp"
+#include "utils.hpp"
+#include "max_flow.hpp"
+#include "parallel_bfs.hpp"
+#include "parallel.hpp"
+#include "metrics.hpp"
+#include <climits>
+#include <map>
+#include <random>
+#include <unordered_map>
 
 using namespace std;
 
-bool is_connected(const Graph &graph)
+namespace
 {
-	int n = graph.getOrder();
-	vector<bool> visited(n + 1);
-	if (n <= 1)
-		return true;
+	// Snapshot so dos vertices vivos, renumerados 1..getLiveVertexCount();
+	// oldId[novo] = id no grafo (vazio se nenhum vertice foi removido)
+	CsrGraph live_snapshot(const Graph &graph, vector<int> &oldId)
+	{
+		oldId.clear();
+		if (graph.getLiveVertexCount() == graph.getOrder())
+			return graph.freeze();
+		Graph copy(graph);
+		vector<int> mapping = copy.compact();
+		oldId.assign(copy.getOrder() + 1, 0);
+		for (int v = 1; v < static_cast<int>(mapping.size()); ++v)
+		{
+			if (mapping[v] != 0)
+				oldId[mapping[v]] = v;
+		}
+		return copy.freeze();
+	}
 
-	for (int i = 2; i <= n; i++)
+	void restore_ids(vector<int> &vertices, const vector<int> &oldId)
 	{
-		visited[i] = false;
+		if (oldId.empty())
+			return;
+		for (int &v : vertices)
+			v = oldId[v];
 	}
-	visited[1] = true;
-	queue<int> queue;
-	queue.push(1);
-	while (!queue.empty())
+
+	// Vertices removidos ficam sem componente (rotulo -1): sao isolados no snapshot, entao cada
+	// um era uma componente so sua, que sai da contagem; as demais mantem a ordem
+	void drop_removed_vertices(ComponentLabels &components, const Graph &graph)
 	{
-		int u = queue.front();
-		queue.pop();
-		auto current = graph.getAdjacencyList(u);
-		// Fazendo a travecia na lista ligada
-		while (current != nullptr)
+		int n = graph.getOrder();
+		vector<int> newId(components.count, -1);
+		for (int v = 1; v <= n; ++v)
 		{
-			int w = current->vertex;
-			current = current->next;
-			if (visited[w] == false)
-			{
-				visited[w] = true;
-				queue.push(w);
-			}
+			if (graph.isVertexLive(v))
+				newId[components.label[v]] = 0;
+		}
+		components.count = 0;
+		for (int &id : newId)
+		{
+			if (id == 0)
+				id = components.count++;
+		}
+		components.sizes.assign(components.count, 0);
+		for (int v = 1; v <= n; ++v)
+		{
+			components.label[v] = graph.isVertexLive(v) ? newId[components.label[v]] : -1;
+			if (components.label[v] >= 0)
+				components.sizes[components.label[v]]++;
 		}
+		map<int, int> bySize;
+		for (int size : components.sizes)
+			bySize[size]++;
+		components.histogram.assign(bySize.begin(), bySize.end());
 	}
+} // namespace
 
-	for (int j = 1; j <= n; j++)
-	{
-		if (visited[j] == false)
-			return false;
-	}
-	return true;
+// Uma rotulacao por versao do grafo responde todas as consultas de componentes
+shared_ptr<const ComponentLabels> memoized_component_labels(const Graph &graph)
+{
+	return graph.memoize<ComponentLabels>(DerivedProperty::ComponentLabels, [&graph]() {
+		ComponentLabels components = component_labels(graph.freeze());
+		if (graph.getLiveVertexCount() != graph.getOrder())
+			drop_removed_vertices(components, graph);
+		return components;
+	});
+}
+
+bool is_connected(const Graph &graph)
+{
+	GRAPH_METRICS_SCOPE("is_connected");
+	return is_connected(*memoized_component_labels(graph));
 }
 
 int vertices_amount_in_connected_component(const Graph &graph, int v)
 {
-	int n = graph.getOrder();
-	vector<bool> visited(n + 1);
+	GRAPH_METRICS_SCOPE("vertices_amount_in_connected_component");
+	return vertices_amount_in_connected_component(*memoized_component_labels(graph), v);
+}
+
+int connected_component_amount(const Graph &graph)
+{
+	GRAPH_METRICS_SCOPE("connected_component_amount");
+	return connected_component_amount(*memoized_component_labels(graph));
+}
+
+bool is_k_edge_connected(Graph &graph, int k)
+{
+	GRAPH_METRICS_SCOPE("is_k_edge_connected");
+	// λ(G) e calculado uma unica vez, sem copiar o grafo
+	return edge_connectivity(graph) >= k;
+}
+
+namespace
+{
+	// Aresta ponderada entre supervertices do grafo contraido
+	struct WeightedEdge
+	{
+		int u, v, w;
+	};
 
-	for (int i = 1; i <= n; i++)
+	int find_root(vector<int> &parent, int x)
 	{
-		visited[i] = false;
+		GRAPH_METRICS_ADD(UnionFindFinds, 1);
+		while (parent[x] != x)
+		{
+			parent[x] = parent[parent[x]]; // path halving
+			x = parent[x];
+		}
+		return x;
 	}
-	visited[v] = true;
-	queue<int> queue;
-	queue.push(v);
-	int count = 1;
-	while (!queue.empty())
+
+	/**
+	 * @brief Nagamochi–Ibaraki minimum cut of a connected multigraph
+	 *
+	 * Every round runs CAPFOREST: a maximum-adjacency ordering whose priorities are capped at
+	 * the best cut value known so far (λ̂). An edge whose attachment value reaches λ̂ joins two
+	 * vertices that no cut smaller than λ̂ separates, so it is contracted. Every cut of a
+	 * contracted graph is a cut of the original one, and λ is the smallest weighted degree seen
+	 * across all rounds. Each round costs O(n + m + λ̂).
+	 * @param k Number of super vertices (0 .. k-1)
+	 * @param edges Loop-free edges between super vertices, parallel edges merged into weights
+	 * @param superOf Super vertex of every original vertex (index 0 unused)
+	 * @param best In: upper bound for λ. Out: λ
+	 * @param bestSide Out: original vertices on one side of a minimum cut, if below the input bound
+	 */
+	void nagamochi_ibaraki(int k, vector<WeightedEdge> edges, vector<int> superOf, int &best, vector<int> &bestSide)
 	{
-		int u = queue.front();
-		queue.pop();
-		auto current = graph.getAdjacencyList(u);
-		// Fazendo a travecia na lista ligada
-		while (current != nullptr)
+		int n = static_cast<int>(superOf.size()) - 1;
+		while (k > 1)
 		{
-			int w = current->vertex;
-			current = current->next;
-			if (visited[w] == false)
+			// Listas de adjacencia do grafo contraido
+			vector<int> start(k + 1, 0), weightedDegree(k, 0);
+			for (const WeightedEdge &e : edges)
 			{
-				visited[w] = true;
-				queue.push(w);
-				count++;
+				++start[e.u + 1];
+				++start[e.v + 1];
+				weightedDegree[e.u] += e.w;
+				weightedDegree[e.v] += e.w;
+			}
+			for (int x = 0; x < k; ++x)
+				start[x + 1] += start[x];
+			GRAPH_METRICS_ADD(VerticesTouched, k);
+			GRAPH_METRICS_ADD(EdgesTouched, 2 * edges.size());
+			vector<int> fill(start.begin(), start.end() - 1), target(start[k]), weight(start[k]);
+			for (const WeightedEdge &e : edges)
+			{
+				target[fill[e.u]] = e.v;
+				weight[fill[e.u]++] = e.w;
+				target[fill[e.v]] = e.u;
+				weight[fill[e.v]++] = e.w;
 			}
-		}
-	}
-	return count;
-}
 
-int connected_component_amount(const Graph &graph)
-{
+			// Corte trivial: o supervertice de menor grau contra o resto
+			int lightest = static_cast<int>(min_element(weightedDegree.begin(), weightedDegree.end()) - weightedDegree.begin());
+			if (weightedDegree[lightest] < best)
+			{
+				best = weightedDegree[lightest];
+				bestSide.clear();
+				for (int v = 1; v <= n; ++v)
+				{
+					if (superOf[v] == lightest)
+						bestSide.push_back(v);
+				}
+			}
 
-	int n = graph.getOrder();
-	// vetor de visitados, indexado de 1 a n
-	vector<bool> visited(n + 1, false);
-	int count = 0;
-	queue<int> q;
+			// CAPFOREST com fila de baldes (prioridades limitadas a best)
+			vector<int> parent(k), r(k, 0);
+			vector<bool> scanned(k, false);
+			for (int x = 0; x < k; ++x)
+				parent[x] = x;
+			vector<vector<int>> bucket(best + 1);
+			bucket[0].push_back(0);
+			int top = 0, last = -1, beforeLast = -1;
+			bool contracted = false;
+			while (true)
+			{
+				while (top >= 0 && bucket[top].empty())
+					--top;
+				if (top < 0)
+					break;
+				int x = bucket[top].back();
+				bucket[top].pop_back();
+				GRAPH_METRICS_ADD(HeapOperations, 1);
+				if (scanned[x] || min(r[x], best) != top)
+					continue; // entrada desatualizada
+				scanned[x] = true;
+				beforeLast = last;
+				last = x;
+				for (int i = start[x]; i < start[x + 1]; ++i)
+				{
+					int y = target[i];
+					if (scanned[y] || r[y] >= best)
+						continue;
+					r[y] += weight[i];
+					if (r[y] >= best)
+					{
+						int a = find_root(parent, x), b = find_root(parent, y);
+						if (a != b)
+						{
+							parent[a] = b;
+							contracted = true;
+						}
+					}
+					int key = min(r[y], best);
+					bucket[key].push_back(y);
+					GRAPH_METRICS_ADD(HeapOperations, 1);
+					top = max(top, key);
+				}
+			}
+			// Sem arestas contraiveis, o ultimo par da ordem ainda pode ser contraido:
+			// λ(s, t) e o grau de t, que ja foi considerado acima
+			if (!contracted)
+				parent[find_root(parent, last)] = find_root(parent, beforeLast);
 
-	// varre todos os vértices; toda vez que encontrar um não visitado,
-	// inicia uma BFS para marcar toda a sua componente
-	for (int i = 1; i <= n; ++i)
-	{
-		if (!visited[i])
-		{
-			++count; // nova componente encontrada
-			visited[i] = true;
-			q.push(i);
+			// Renumera os supervertices e junta arestas paralelas
+			vector<int> newId(k, -1);
+			int next = 0;
+			for (int x = 0; x < k; ++x)
+			{
+				if (find_root(parent, x) == x)
+					newId[x] = next++;
+			}
+			for (int x = 0; x < k; ++x)
+				newId[x] = newId[find_root(parent, x)];
+			for (int v = 1; v <= n; ++v)
+				superOf[v] = newId[superOf[v]];
 
-			// BFS para marcar todos os vértices conectados a i
-			while (!q.empty())
+			vector<vector<WeightedEdge>> byLower(next);
+			for (const WeightedEdge &e : edges)
+			{
+				int a = newId[e.u], b = newId[e.v];
+				if (a == b)
+					continue;
+				if (a > b)
+					swap(a, b);
+				byLower[a].push_back({a, b, e.w});
+			}
+			edges.clear();
+			vector<int> position(next, -1);
+			for (int a = 0; a < next; ++a)
 			{
-				int u = q.front();
-				q.pop();
-				auto current = graph.getAdjacencyList(u);
-				while (current != nullptr)
+				size_t first = edges.size();
+				for (const WeightedEdge &e : byLower[a])
 				{
-					int w = current->vertex;
-					if (!visited[w])
+					if (position[e.v] == -1)
 					{
-						visited[w] = true;
-						q.push(w);
+						position[e.v] = static_cast<int>(edges.size());
+						edges.push_back(e);
+					}
+					else
+					{
+						edges[position[e.v]].w += e.w;
 					}
-					current = current->next;
 				}
+				for (size_t i = first; i < edges.size(); ++i)
+					position[edges[i].v] = -1;
+			}
+			k = next;
+		}
+	}
+} // namespace
+
+EdgeCut minimum_edge_cut(const CsrGraph &graph)
+{
+	GRAPH_METRICS_SCOPE("minimum_edge_cut");
+	int n = graph.getOrder();
+	EdgeCut cut;
+	if (n < 2)
+	{
+		if (n == 1)
+			cut.side.push_back(1);
+		return cut;
+	}
+
+	// Grafo desconexo: o corte vazio separa a componente do vertice 1
+	vector<bool> inSide(n + 1, false);
+	bfs(graph, 1, inSide);
+	bool connected = count(inSide.begin() + 1, inSide.end(), true) == n;
+
+	if (connected)
+	{
+		// Cada vertice comeca como seu proprio supervertice; lacos nao entram em cortes
+		vector<WeightedEdge> edges;
+		edges.reserve(graph.getSize());
+		for (int u = 1; u <= n; ++u)
+		{
+			for (int w : graph.neighbors(u))
+			{
+				if (u < w)
+					edges.push_back({u - 1, w, 1});
 			}
 		}
+		for (WeightedEdge &e : edges)
+			e.v -= 1;
+		vector<int> superOf(n + 1);
+		for (int v = 1; v <= n; ++v)
+			superOf[v] = v - 1;
+
+		int best = INT_MAX;
+		vector<int> side;
+		nagamochi_ibaraki(n, edges, superOf, best, side);
+
+		fill(inSide.begin(), inSide.end(), false);
+		for (int v : side)
+			inSide[v] = true;
+	}
+
+	for (int u = 1; u <= n; ++u)
+	{
+		if (!inSide[u])
+			continue;
+		cut.side.push_back(u);
+		for (uint64_t e = graph.edgeBegin(u); e < graph.edgeEnd(u); ++e)
+		{
+			if (!inSide[graph.target(e)])
+				cut.edges.emplace_back(u, graph.target(e), graph.weight(e));
+		}
 	}
+	cut.size = static_cast<int>(cut.edges.size());
+	return cut;
+}
 
-	return count;
+EdgeCut minimum_edge_cut(const Graph &graph)
+{
+	GRAPH_METRICS_SCOPE("minimum_edge_cut");
+	vector<int> oldId;
+	EdgeCut cut = minimum_edge_cut(live_snapshot(graph, oldId));
+	restore_ids(cut.side, oldId);
+	if (!oldId.empty())
+	{
+		for (Edge &edge : cut.edges)
+		{
+			edge.u = oldId[edge.u];
+			edge.v = oldId[edge.v];
+		}
+	}
+	return cut;
 }
 
-bool is_k_edge_connected(Graph &graph, int k)
+int edge_connectivity(const Graph &graph)
+{
+	GRAPH_METRICS_SCOPE("edge_connectivity");
+	return minimum_edge_cut(graph).size;
+}
+
+VertexCut minimum_vertex_separator(const CsrGraph &graph)
 {
+	GRAPH_METRICS_SCOPE("minimum_vertex_separator");
 	int n = graph.getOrder();
-	int m = graph.getSize();
+	VertexCut cut;
+	cut.size = max(n - 1, 0);
+	if (n < 2)
+		return cut;
 
-	if (k > graph.getMaxDegree())
-		return false;
+	// Grafo desconexo: separador vazio
+	vector<bool> reached(n + 1, false);
+	bfs(graph, 1, reached);
+	if (count(reached.begin() + 1, reached.end(), true) != n)
+	{
+		cut.size = 0;
+		for (int v = 1; v <= n; ++v)
+		{
+			if (reached[v])
+				cut.side.push_back(v);
+		}
+		return cut;
+	}
 
-	if (m == n * (n - 1) / 2)
-		return true;
+	GRAPH_METRICS_ADD(VerticesTouched, n);
+	GRAPH_METRICS_ADD(EdgesTouched, 2 * static_cast<uint64_t>(graph.getSize()));
+	// Vizinhos distintos de cada vertice (ignorando lacos e arestas paralelas).
+	// Os vizinhos do vertice de menor grau ja formam um separador, se nao cobrirem o resto do grafo
+	vector<int> stamp(n + 1, 0);
+	int lightest = 0, lightestDegree = n - 1;
+	for (int u = 1; u <= n; ++u)
+	{
+		int distinct = 0;
+		for (int w : graph.neighbors(u))
+		{
+			if (w != u && stamp[w] != u)
+			{
+				stamp[w] = u;
+				++distinct;
+			}
+		}
+		if (distinct < lightestDegree)
+		{
+			lightest = u;
+			lightestDegree = distinct;
+		}
+	}
+	if (lightest == 0)
+		return cut; // grafo completo: nao ha separador, κ = n - 1
 
-	if (k == 1)
-		return is_connected(graph);
+	cut.size = lightestDegree;
+	cut.side.assign(1, lightest);
+	fill(stamp.begin(), stamp.end(), 0);
+	for (int w : graph.neighbors(lightest))
+	{
+		if (w != lightest && stamp[w] == 0)
+		{
+			stamp[w] = 1;
+			cut.separator.push_back(w);
+		}
+	}
 
-	for (int i = 1; i <= m; ++i)
+	// Rede com cada vertice v dividido em v_in = 2v e v_out = 2v + 1, ligados por um arco de
+	// capacidade 1; cada aresta vira dois arcos out -> in que nunca ficam saturados num corte minimo
+	FlowNetwork network(2 * (n + 1));
+	for (int v = 1; v <= n; ++v)
+		network.addArc(2 * v, 2 * v + 1, 1);
+	for (int u = 1; u <= n; ++u)
 	{
-		Graph g = graph;
-		// We need to find the actual edge vertices first
-		std::vector<std::pair<int, int>> edges;
-		for (int u = 1; u <= n; ++u)
+		for (uint64_t e = graph.edgeBegin(u); e < graph.edgeEnd(u); ++e)
 		{
-			auto adj = graph.getAdjacencyList(u);
-			while (adj)
+			int w = graph.target(e);
+			if (w != u)
+				network.addArc(2 * u + 1, 2 * w, n);
+		}
+	}
+
+	// κ(s, t) < cut.size? Se sim, guarda o novo separador
+	vector<int> seen(n + 1, 0);
+	int probe = 0;
+	auto separate = [&](int source, int sink) {
+		// stamp[w] == source marca os vizinhos da fonte; vizinhos em comum sao caminhos disjuntos
+		int common = 0;
+		++probe;
+		for (int w : graph.neighbors(sink))
+		{
+			if (stamp[w] == source && seen[w] != probe)
 			{
-				if (u < adj->vertex)
-					edges.emplace_back(u, adj->vertex);
-				adj = adj->next;
+				seen[w] = probe;
+				++common;
 			}
 		}
-		// Now use the actual vertices to remove the edge
-		g.removeEdge(edges[i - 1].first, edges[i - 1].second);
-		if (!is_k_edge_connected(g, k - 1))
-			return false;
+		if (common >= cut.size)
+			return;
+		network.reset();
+		int flow = network.maxFlowByPaths(2 * source + 1, 2 * sink, cut.size);
+		if (flow >= cut.size)
+			return;
+
+		// Separador: vertices cujo arco interno cruza o corte minimo
+		vector<bool> sourceSide = network.sourceSide(2 * source + 1);
+		cut.size = flow;
+		cut.separator.clear();
+		cut.side.clear();
+		for (int v = 1; v <= n; ++v)
+		{
+			if (sourceSide[2 * v] && !sourceSide[2 * v + 1])
+				cut.separator.push_back(v);
+			else if (sourceSide[2 * v + 1])
+				cut.side.push_back(v);
+		}
+	};
+
+	// Se o vertice de menor grau fica fora de algum separador minimo, ele e separado de algum
+	// vertice nao adjacente. Senao, ele tem vizinhos em duas componentes, que sao separados entre si
+	vector<int> around(cut.separator);
+	fill(stamp.begin(), stamp.end(), 0);
+	for (int w : graph.neighbors(lightest))
+		stamp[w] = lightest;
+	for (int w = 1; w <= n; ++w)
+	{
+		if (w != lightest && stamp[w] != lightest)
+			separate(lightest, w);
 	}
-	return true;
+	for (size_t i = 0; i < around.size(); ++i)
+	{
+		int x = around[i];
+		for (int w : graph.neighbors(x))
+			stamp[w] = x;
+		for (size_t j = i + 1; j < around.size(); ++j)
+		{
+			if (stamp[around[j]] != x)
+				separate(x, around[j]);
+		}
+	}
+	return cut;
 }
 
-bool is_k_vertex_connected(Graph &graph, int k)
+VertexCut minimum_vertex_separator(const Graph &graph)
 {
-	int n = graph.getOrder();
-	int m = graph.getSize();
+	GRAPH_METRICS_SCOPE("minimum_vertex_separator");
+	vector<int> oldId;
+	VertexCut cut = minimum_vertex_separator(live_snapshot(graph, oldId));
+	restore_ids(cut.separator, oldId);
+	restore_ids(cut.side, oldId);
+	return cut;
+}
 
-	if (m == n * (n - 1) / 2)
-		return true;
+int vertex_connectivity(const Graph &graph)
+{
+	GRAPH_METRICS_SCOPE("vertex_connectivity");
+	return minimum_vertex_separator(graph).size;
+}
 
-	if (k > graph.getMinDegree())
+bool is_complete(const CsrGraph &graph)
+{
+	int n = graph.getOrder();
+	// Menos de n(n-1)/2 arestas nunca formam um grafo completo (conta em 64 bits)
+	if (static_cast<int64_t>(graph.getSize()) < static_cast<int64_t>(n) * (n - 1) / 2)
 		return false;
 
-	if (k == 1)
-		return is_connected(graph);
-
-	for (int v = 1; v <= n; ++v)
+	// Arestas paralelas e lacos podem completar a conta: cada vertice precisa de n - 1 vizinhos distintos
+	vector<int> stamp(n + 1, 0);
+	for (int u = 1; u <= n; ++u)
 	{
-		Graph g = graph;
-		g.removeVertex(v);
-		if (!is_k_vertex_connected(g, k - 1))
+		int distinct = 0;
+		for (int w : graph.neighbors(u))
 		{
-			return false;
+			if (w != u && stamp[w] != u)
+			{
+				stamp[w] = u;
+				++distinct;
+			}
 		}
+		if (distinct != n - 1)
+			return false;
 	}
 	return true;
 }
 
+bool is_complete(const Graph &graph)
+{
+	vector<int> oldId;
+	return is_complete(live_snapshot(graph, oldId));
+}
+
+namespace
+{
+	// Graph e CsrGraph: grafos completos e grau minimo decidem sem calcular κ
+	template <typename GraphType>
+	bool k_vertex_connected(const GraphType &graph, int k)
+	{
+		if (is_complete(graph))
+			return true;
+
+		if (k > graph.getMinDegree())
+			return false;
+
+		return minimum_vertex_separator(graph).size >= k;
+	}
+} // namespace
+
+bool is_k_vertex_connected(Graph &graph, int k)
+{
+	GRAPH_METRICS_SCOPE("is_k_vertex_connected");
+	return k_vertex_connected(graph, k);
+}
+
+bool is_k_vertex_connected(const CsrGraph &graph, int k)
+{
+	GRAPH_METRICS_SCOPE("is_k_vertex_connected");
+	return k_vertex_connected(graph, k);
+}
+
+bool is_k_edge_connected(const CsrGraph &graph, int k)
+{
+	GRAPH_METRICS_SCOPE("is_k_edge_connected");
+	return minimum_edge_cut(graph).size >= k;
+}
+
 bool is_forest(Graph &graph)
 {
-	// Obtém o número de vértices e arestas
+	GRAPH_METRICS_SCOPE("is_forest");
+	// n - c conta so os vertices vivos
+	return graph.getSize() == graph.getLiveVertexCount() - memoized_component_labels(graph)->count;
+}
+
+bool is_connected(const CsrGraph &graph)
+{
+	GRAPH_METRICS_SCOPE("is_connected");
+	int n = graph.getOrder();
+	if (n <= 1)
+		return true;
+	return ParallelBfs(graph).run(1) == n;
+}
+
+int vertices_amount_in_connected_component(const CsrGraph &graph, int v)
+{
+	GRAPH_METRICS_SCOPE("vertices_amount_in_connected_component");
+	// Vertice inexistente nao tem componente
+	if (v < 1 || v > graph.getOrder())
+		return 0;
+	return ParallelBfs(graph).run(v);
+}
+
+int connected_component_amount(const CsrGraph &graph)
+{
+	GRAPH_METRICS_SCOPE("connected_component_amount");
+	return component_labels(graph).count;
+}
+
+bool is_forest(const CsrGraph &graph)
+{
+	GRAPH_METRICS_SCOPE("is_forest");
 	int n = graph.getOrder();
 	int m = graph.getSize();
 
-	// Se o grafo está vazio, é uma floresta
 	if (n == 0)
 		return true;
-
-	// Se tem mais arestas que vértices, não é uma floresta
 	if (m >= n)
 		return false;
 
-	// Inicializa vetores de visitados e anteriores
-	vector<bool> visited(n + 1, false);
-	vector<int> previous(n + 1, 0);
-	queue<int> q;
+	// Uma floresta com c componentes tem exatamente n - c arestas; qualquer aresta a mais
+	// (inclusive lacos e arestas paralelas) fecha um ciclo
+	return m == n - connected_component_amount(graph);
+}
 
-	// Para cada vértice não visitado, inicia uma BFS
-	for (int i = 1; i <= n; ++i)
-	{
-		if (!visited[i])
-		{
-			// Marca o vértice como visitado
-			visited[i] = true;
-			q.push(i);
+namespace
+{
+	const int AFFOREST_NEIGHBOR_ROUNDS = 2;
+	const int AFFOREST_SAMPLES = 1024;
+} // namespace
 
-			// BFS para detectar ciclos
-			while (!q.empty())
-			{
-				int u = q.front();
-				q.pop();
+ComponentLabels component_labels(const CsrGraph &graph, int threads)
+{
+	GRAPH_METRICS_SCOPE("component_labels");
+	int n = graph.getOrder();
+	threads = resolve_thread_count(threads);
+	ComponentLabels components;
+	components.label.assign(n + 1, -1);
+	if (n == 0)
+		return components;
+
+	// A raiz de cada conjunto e o seu menor vertice
+	ConcurrentUnionFind uf(n);
 
-				// Percorre todos os vértices adjacentes
-				auto current = graph.getAdjacencyList(u);
-				while (current != nullptr)
+	// Fase 1: cada vertice se liga aos primeiros vizinhos
+	for (int round = 0; round < AFFOREST_NEIGHBOR_ROUNDS; ++round)
+	{
+		parallel_for(1, n + 1, threads, [&](size_t first, size_t last, int) {
+			uint64_t scanned = 0;
+			for (size_t v = first; v < last; ++v)
+			{
+				uint64_t e = graph.edgeBegin(static_cast<int>(v)) + round;
+				if (e < graph.edgeEnd(static_cast<int>(v)))
 				{
-					int w = current->vertex;
-					// Se não é o vértice anterior
-					if (previous[u] != w)
-					{
-						// Se já foi visitado, existe um ciclo
-						if (visited[w])
-						{
-							return false;
-						}
-						else
-						{
-							visited[w] = true;
-							previous[w] = u;
-							q.push(w);
-						}
-					}
-					current = current->next;
+					uf.unite(static_cast<int>(v), graph.target(e));
+					++scanned;
 				}
 			}
+			GRAPH_METRICS_ADD(VerticesTouched, last - first);
+			GRAPH_METRICS_ADD(EdgesTouched, scanned);
+		});
+	}
+
+	// Fase 2: a componente mais frequente numa amostra e (provavelmente) a gigante
+	mt19937 random(12345);
+	uniform_int_distribution<int> pick(1, n);
+	unordered_map<int, int> frequency;
+	int giant = uf.find(1);
+	int giantFrequency = 0;
+	for (int i = 0; i < AFFOREST_SAMPLES; ++i)
+	{
+		int root = uf.find(pick(random));
+		if (++frequency[root] > giantFrequency)
+		{
+			giantFrequency = frequency[root];
+			giant = root;
 		}
 	}
-	// Se não encontrou ciclos, é uma floresta
-	return true;
-}
\ No newline at end of file
+
+	// Fase 3: so os vertices fora da gigante ligam o resto das arestas; uma aresta entre a
+	// gigante e outra componente e vista pelo lado de fora
+	parallel_for(1, n + 1, threads, [&](size_t first, size_t last, int) {
+		uint64_t scanned = 0;
+		for (size_t v = first; v < last; ++v)
+		{
+			if (uf.find(static_cast<int>(v)) == giant)
+				continue;
+			for (uint64_t e = graph.edgeBegin(static_cast<int>(v)) + AFFOREST_NEIGHBOR_ROUNDS; e < graph.edgeEnd(static_cast<int>(v)); ++e)
+			{
+				uf.unite(static_cast<int>(v), graph.target(e));
+				++scanned;
+			}
+		}
+		GRAPH_METRICS_ADD(VerticesTouched, last - first);
+		GRAPH_METRICS_ADD(EdgesTouched, scanned);
+	});
+
+	// Raizes sao os menores vertices das componentes: numera na ordem dos vertices
+	vector<int> idOf(n + 1, -1);
+	for (int v = 1; v <= n; ++v)
+	{
+		if (uf.root(v) == v)
+			idOf[v] = components.count++;
+	}
+	parallel_for(1, n + 1, threads, [&](size_t first, size_t last, int) {
+		for (size_t v = first; v < last; ++v)
+			components.label[v] = idOf[uf.find(static_cast<int>(v))];
+	});
+
+	components.sizes.assign(components.count, 0);
+	for (int v = 1; v <= n; ++v)
+		components.sizes[components.label[v]]++;
+	map<int, int> bySize;
+	for (int size : components.sizes)
+		bySize[size]++;
+	components.histogram.assign(bySize.begin(), bySize.end());
+	return components;
+}
+
+ComponentLabels component_labels(const Graph &graph, int threads)
+{
+	GRAPH_METRICS_SCOPE("component_labels");
+	// O resultado nao depende do numero de threads: so a primeira chamada da versao o usa
+	(void)threads;
+	return *memoized_component_labels(graph);
+}
@@ -0,0 +1,159 @@
+#include "max_flow.hpp"
+#include "metrics.hpp"
+#include <algorithm>
+
+FlowNetwork::FlowNetwork(int nodes)
+    : head(nodes, -1), mark(nodes, 0), via(nodes, -1), searchStamp(0)
+{
+}
+
+int FlowNetwork::addArc(int from, int to, int capacity)
+{
+    int arc = static_cast<int>(this->to.size());
+    // arco direto
+    this->to.push_back(to);
+    this->capacity.push_back(capacity);
+    original.push_back(capacity);
+    nextArc.push_back(head[from]);
+    head[from] = arc;
+    // arco residual (parceiro arc ^ 1)
+    this->to.push_back(from);
+    this->capacity.push_back(0);
+    original.push_back(0);
+    nextArc.push_back(head[to]);
+    head[to] = arc + 1;
+    return arc;
+}
+
+void FlowNetwork::reset()
+{
+    // So os arcos usados pelo ultimo fluxo mudaram
+    for (int a : touched)
+        capacity[a] = original[a];
+    touched.clear();
+}
+
+int FlowNetwork::maxFlowByPaths(int source, int sink, int limit)
+{
+    if (source == sink)
+        return 0;
+    int flow = 0;
+    uint64_t expanded = 0, scanned = 0;
+    std::vector<int> forward, backward, next, path;
+    while (flow < limit)
+    {
+        // mark == fromSource: alcancado a partir da fonte; mark == fromSink: alcanca o sorvedouro
+        if (searchStamp > INT_MAX - 2)
+        {
+            std::fill(mark.begin(), mark.end(), 0);
+            searchStamp = 0;
+        }
+        const int fromSource = ++searchStamp;
+        const int fromSink = ++searchStamp;
+        mark[source] = fromSource;
+        via[source] = -1;
+        mark[sink] = fromSink;
+        via[sink] = -1;
+        forward.assign(1, source);
+        backward.assign(1, sink);
+
+        // Expande sempre a menor fronteira, um nivel por vez, ate as buscas se encontrarem
+        int meeting = -1; // arco que liga as duas buscas
+        while (meeting == -1 && !forward.empty() && !backward.empty())
+        {
+            next.clear();
+            if (forward.size() <= backward.size())
+            {
+                for (size_t i = 0; i < forward.size() && meeting == -1; ++i)
+                {
+                    ++expanded;
+                    for (int a = head[forward[i]]; a != -1; a = nextArc[a])
+                    {
+                        ++scanned;
+                        int w = to[a];
+                        if (capacity[a] <= 0 || mark[w] == fromSource)
+                            continue;
+                        if (mark[w] == fromSink)
+                        {
+                            meeting = a;
+                            break;
+                        }
+                        mark[w] = fromSource;
+                        via[w] = a;
+                        next.push_back(w);
+                    }
+                }
+                forward.swap(next);
+            }
+            else
+            {
+                for (size_t i = 0; i < backward.size() && meeting == -1; ++i)
+                {
+                    ++expanded;
+                    for (int b = head[backward[i]]; b != -1; b = nextArc[b])
+                    {
+                        ++scanned;
+                        int a = b ^ 1; // arco que entra no vertice da fronteira
+                        int w = to[b];
+                        if (capacity[a] <= 0 || mark[w] == fromSink)
+                            continue;
+                        if (mark[w] == fromSource)
+                        {
+                            meeting = a;
+                            break;
+                        }
+                        mark[w] = fromSink;
+                        via[w] = a;
+                        next.push_back(w);
+                    }
+                }
+                backward.swap(next);
+            }
+        }
+        if (meeting == -1)
+            break;
+
+        // Caminho: da fonte ate o arco de encontro, e dele ate o sorvedouro
+        path.assign(1, meeting);
+        for (int u = to[meeting ^ 1]; via[u] != -1; u = to[via[u] ^ 1])
+            path.push_back(via[u]);
+        for (int u = to[meeting]; via[u] != -1; u = to[via[u]])
+            path.push_back(via[u]);
+
+        int pushed = limit - flow;
+        for (int a : path)
+            pushed = std::min(pushed, capacity[a]);
+        for (int a : path)
+        {
+            capacity[a] -= pushed;
+            capacity[a ^ 1] += pushed;
+            touched.push_back(a);
+            touched.push_back(a ^ 1);
+        }
+        flow += pushed;
+    }
+    GRAPH_METRICS_ADD(VerticesTouched, expanded);
+    GRAPH_METRICS_ADD(EdgesTouched, scanned);
+    return flow;
+}
+
+std::vector<bool> FlowNetwork::sourceSide(int source) const
+{
+    std::vector<bool> reached(head.size(), false);
+    std::vector<int> stack(1, source);
+    reached[source] = true;
+    while (!stack.empty())
+    {
+        int u = stack.back();
+        stack.pop_back();
+        for (int a = head[u]; a != -1; a = nextArc[a])
+        {
+            if (capacity[a] > 0 && !reached[to[a]])
+            {
+                reached[to[a]] = true;
+                stack.push_back(to[a]);
+            }
+        }
+    }
+    return reached;
+}
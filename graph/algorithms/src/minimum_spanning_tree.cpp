@@ -1,6 +1,14 @@
 #include "minimum_spanning_tree.hpp"
 #include "connected.hpp"
+#include "indexed_heap.hpp"
+#include "parallel.hpp"
+#include "metrics.hpp"
 #include <algorithm>
+#include <atomic>
+#include <functional>
+#include <queue>
+#include <random>
+#include <tuple>
 #include <vector>
 
 // print the mst
@@ -14,7 +22,10 @@ void print_mst(const vector<Edge> &mst)
 
 vector<Edge> kruskal_mst_naive(const Graph &graph)
 {
+    GRAPH_METRICS_SCOPE("kruskal_mst_naive");
     int n = graph.getOrder();
+    GRAPH_METRICS_ADD(VerticesTouched, n);
+    GRAPH_METRICS_ADD(EdgesTouched, 2 * static_cast<uint64_t>(graph.getSize()));
     vector<Edge> T; // MST edges
     vector<Edge> edges;
 
@@ -73,7 +84,10 @@ Representando a mesma ideia, a otimização reduz a complexidade temporal de O(n
 
 vector<Edge> kruskal_mst_paint(const Graph &graph)
 {
+    GRAPH_METRICS_SCOPE("kruskal_mst_paint");
     int n = graph.getOrder();
+    GRAPH_METRICS_ADD(VerticesTouched, n);
+    GRAPH_METRICS_ADD(EdgesTouched, 2 * static_cast<uint64_t>(graph.getSize()));
     vector<Edge> T;
     vector<Edge> edges;
     vector<int> color(n + 1, 0); // 0 = incolor
@@ -127,6 +141,7 @@ vector<Edge> kruskal_mst_paint(const Graph &graph)
             // Pinta todos da menor componente com a cor da maior
             int count_color_u = count(color.begin(), color.end(), color_u);
             int count_color_v = count(color.begin(), color.end(), color_v);
+            GRAPH_METRICS_ADD(VerticesTouched, 3 * static_cast<uint64_t>(n)); // duas contagens e a repintura
             int from = (count_color_u < count_color_v) ? color_u : color_v;
             int to = (count_color_u < count_color_v) ? color_v : color_u;
             for (int i = 1; i <= n; ++i)
@@ -141,50 +156,57 @@ vector<Edge> kruskal_mst_paint(const Graph &graph)
     return T;
 }
 
-vector<Edge> kruskal_mst(const Graph &graph)
+namespace
 {
-    int n = graph.getOrder();
-    vector<Edge> T; // MST edges
-    vector<Edge> edges;
-
-    // Coleta todas as arestas do grafo
-    for (int u = 1; u <= n; ++u)
+    vector<Edge> kruskal_mst_lists(const Graph &graph)
     {
-        auto current = graph.getAdjacencyList(u);
-        while (current != nullptr)
+        int n = graph.getOrder();
+        GRAPH_METRICS_ADD(VerticesTouched, n);
+        GRAPH_METRICS_ADD(EdgesTouched, 2 * static_cast<uint64_t>(graph.getSize()));
+        vector<Edge> T; // MST edges
+        vector<Edge> edges;
+
+        // Coleta todas as arestas do grafo
+        for (int u = 1; u <= n; ++u)
         {
-            if (u < current->vertex)
+            auto current = graph.getAdjacencyList(u);
+            while (current != nullptr)
             {
-                edges.emplace_back(u, current->vertex, current->weight);
+                if (u < current->vertex)
+                {
+                    edges.emplace_back(u, current->vertex, current->weight);
+                }
+                current = current->next;
             }
-            current = current->next;
         }
-    }
 
-    // Ordena as arestas por peso
-    sort(edges.begin(), edges.end(), [](const Edge &a, const Edge &b)
-         { return a.weight < b.weight; });
+        // Ordena as arestas por peso (empates por u e v), em paralelo
+        parallel_sort(edges, edge_less);
 
-    UnionFind uf(n);
+        UnionFind uf(n);
 
-    // Processa as arestas em ordem crescente de peso
-    for (const Edge &edge : edges)
-    {
-        if (T.size() >= n - 1)
-            break;
-        int u_set = uf.find(edge.u);
-        int v_set = uf.find(edge.v);
-        if (u_set != v_set)
+        // Processa as arestas em ordem crescente de peso
+        for (const Edge &edge : edges)
         {
-            T.push_back(edge);
-            uf.unite(u_set, v_set);
+            if (static_cast<int>(T.size()) >= n - 1)
+                break;
+            if (uf.unite(edge.u, edge.v))
+                T.push_back(edge);
         }
+        return T;
     }
-    return T;
+} // namespace
+
+vector<Edge> kruskal_mst(const Graph &graph)
+{
+    GRAPH_METRICS_SCOPE("kruskal_mst");
+    return *graph.memoize<vector<Edge>>(DerivedProperty::MinimumSpanningTree,
+                                        [&graph]() { return kruskal_mst_lists(graph); });
 }
 
 vector<Edge> prim_mst_naive(const Graph &graph)
 {
+    GRAPH_METRICS_SCOPE("prim_mst_naive");
     int n = graph.getOrder();
     vector<Edge> T; // T = {}
     vector<bool> in_tree(n + 1, false);
@@ -194,6 +216,9 @@ vector<Edge> prim_mst_naive(const Graph &graph)
     {
         int min_weight = INT_MAX;
         int u_min = -1, v_min = -1;
+        // Cada passo percorre Z inteiro
+        GRAPH_METRICS_ADD(VerticesTouched, n);
+        GRAPH_METRICS_ADD(EdgesTouched, 2 * static_cast<uint64_t>(graph.getSize()));
 
         // Procura a menor aresta na fronteira
         for (int u = 1; u <= n; ++u)
@@ -222,3 +247,418 @@ vector<Edge> prim_mst_naive(const Graph &graph)
     }
     return T; // DEVOLVA T
 }
+
+namespace
+{
+    // Abaixo deste tamanho o Filter-Kruskal ordena direto
+    const size_t FILTER_KRUSKAL_THRESHOLD = 1 << 16;
+
+    /**
+     * @brief Collect every edge of a snapshot once (u < v), in parallel over ranges of vertices
+     */
+    vector<Edge> collect_edges(const CsrGraph &graph, int threads)
+    {
+        int n = graph.getOrder();
+        GRAPH_METRICS_ADD(VerticesTouched, n);
+        GRAPH_METRICS_ADD(EdgesTouched, 2 * static_cast<uint64_t>(graph.getSize()));
+        int workers = resolve_thread_count(threads);
+        vector<size_t> start(workers + 1, 0);
+        auto count = [&](size_t first, size_t last, int t) {
+            for (size_t u = first; u < last; ++u)
+            {
+                for (int w : graph.neighbors(static_cast<int>(u)))
+                {
+                    if (static_cast<int>(u) < w)
+                        ++start[t + 1];
+                }
+            }
+        };
+        parallel_for(1, n + 1, workers, count);
+        for (int t = 0; t < workers; ++t)
+            start[t + 1] += start[t];
+
+        vector<Edge> edges(start[workers]);
+        parallel_for(1, n + 1, workers, [&](size_t first, size_t last, int t) {
+            size_t next = start[t];
+            for (size_t u = first; u < last; ++u)
+            {
+                for (uint64_t e = graph.edgeBegin(static_cast<int>(u)); e < graph.edgeEnd(static_cast<int>(u)); ++e)
+                {
+                    if (static_cast<int>(u) < graph.target(e))
+                        edges[next++] = Edge(static_cast<int>(u), graph.target(e), graph.weight(e));
+                }
+            }
+        });
+        return edges;
+    }
+
+    /**
+     * @brief Stable parallel split: edges with keep(e) go to kept, the others to dropped (if given)
+     */
+    template <typename Keep>
+    void split_edges(const vector<Edge> &edges, vector<Edge> &kept, vector<Edge> *dropped, int threads, Keep keep)
+    {
+        int workers = resolve_thread_count(threads);
+        GRAPH_METRICS_ADD(EdgesTouched, edges.size());
+        vector<size_t> keptStart(workers + 1, 0), droppedStart(workers + 1, 0);
+        parallel_for(0, edges.size(), workers, [&](size_t first, size_t last, int t) {
+            for (size_t i = first; i < last; ++i)
+                ++(keep(edges[i]) ? keptStart : droppedStart)[t + 1];
+        });
+        for (int t = 0; t < workers; ++t)
+        {
+            keptStart[t + 1] += keptStart[t];
+            droppedStart[t + 1] += droppedStart[t];
+        }
+
+        kept.resize(keptStart[workers]);
+        if (dropped != nullptr)
+            dropped->resize(droppedStart[workers]);
+        parallel_for(0, edges.size(), workers, [&](size_t first, size_t last, int t) {
+            size_t nextKept = keptStart[t], nextDropped = droppedStart[t];
+            for (size_t i = first; i < last; ++i)
+            {
+                if (keep(edges[i]))
+                    kept[nextKept++] = edges[i];
+                else if (dropped != nullptr)
+                    (*dropped)[nextDropped++] = edges[i];
+            }
+        });
+    }
+
+    /**
+     * @brief Plain Kruskal step: sort the edges and add the ones that join two components
+     */
+    template <typename DisjointSets>
+    void kruskal_step(vector<Edge> &edges, DisjointSets &uf, vector<Edge> &T, size_t limit, int threads)
+    {
+        parallel_sort(edges, edge_less, threads);
+        for (const Edge &edge : edges)
+        {
+            if (T.size() >= limit)
+                break;
+            if (uf.unite(edge.u, edge.v))
+                T.push_back(edge);
+        }
+    }
+
+    /**
+     * @brief Filter-Kruskal on a set of edges heavier than everything already processed
+     */
+    void filter_kruskal(vector<Edge> &edges, ConcurrentUnionFind &uf, vector<Edge> &T, size_t limit, int threads, mt19937 &random)
+    {
+        if (T.size() >= limit || edges.empty())
+            return;
+        if (edges.size() <= FILTER_KRUSKAL_THRESHOLD)
+        {
+            kruskal_step(edges, uf, T, limit, threads);
+            return;
+        }
+
+        // Pivo: mediana de uma amostra
+        vector<Edge> sample;
+        for (int i = 0; i < 31; ++i)
+            sample.push_back(edges[random() % edges.size()]);
+        nth_element(sample.begin(), sample.begin() + 15, sample.end(), edge_less);
+        const Edge pivot = sample[15];
+
+        vector<Edge> light, heavy;
+        split_edges(edges, light, &heavy, threads, [&pivot](const Edge &e) { return !edge_less(pivot, e); });
+        vector<Edge>().swap(edges);
+        if (heavy.empty())
+        {
+            // Pivo maximo: nao ha o que separar
+            kruskal_step(light, uf, T, limit, threads);
+            return;
+        }
+
+        filter_kruskal(light, uf, T, limit, threads, random);
+        vector<Edge>().swap(light);
+        if (T.size() >= limit)
+            return;
+
+        // Filtro: arestas pesadas dentro de uma componente ja formada nunca entram na arvore
+        vector<Edge> crossing;
+        split_edges(heavy, crossing, nullptr, threads, [&uf](const Edge &e) { return !uf.connected(e.u, e.v); });
+        vector<Edge>().swap(heavy);
+        filter_kruskal(crossing, uf, T, limit, threads, random);
+    }
+} // namespace
+
+vector<Edge> kruskal_mst(const CsrGraph &graph)
+{
+    GRAPH_METRICS_SCOPE("kruskal_mst");
+    int n = graph.getOrder();
+    vector<Edge> T;
+    vector<Edge> edges = collect_edges(graph, 0);
+    parallel_sort(edges, edge_less);
+
+    UnionFind uf(n);
+    for (const Edge &edge : edges)
+    {
+        if (static_cast<int>(T.size()) >= n - 1)
+            break;
+        if (uf.unite(edge.u, edge.v))
+            T.push_back(edge);
+    }
+    return T;
+}
+
+vector<Edge> filter_kruskal_mst(const Graph &graph, int threads)
+{
+    GRAPH_METRICS_SCOPE("filter_kruskal_mst");
+    return filter_kruskal_mst(graph.freeze(), threads);
+}
+
+vector<Edge> filter_kruskal_mst(const CsrGraph &graph, int threads)
+{
+    GRAPH_METRICS_SCOPE("filter_kruskal_mst");
+    int n = graph.getOrder();
+    vector<Edge> T;
+    if (n == 0)
+        return T;
+    threads = resolve_thread_count(threads);
+    vector<Edge> edges = collect_edges(graph, threads);
+
+    ConcurrentUnionFind uf(n); // o filtro consulta de varias threads
+    mt19937 random(12345); // semente fixa: mesma execucao para a mesma entrada
+    filter_kruskal(edges, uf, T, static_cast<size_t>(n - 1), threads, random);
+    return T;
+}
+
+vector<Edge> boruvka_mst(const Graph &graph, int threads)
+{
+    GRAPH_METRICS_SCOPE("boruvka_mst");
+    return boruvka_mst(graph.freeze(), threads);
+}
+
+vector<Edge> boruvka_mst(const CsrGraph &graph, int threads)
+{
+    GRAPH_METRICS_SCOPE("boruvka_mst");
+    int n = graph.getOrder();
+    int m = graph.getSize();
+    vector<Edge> T;
+    if (n == 0)
+        return T;
+    threads = resolve_thread_count(threads);
+
+    // Aresta de cada id com u < v (lacos ficam com u == v e nunca sao escolhidos)
+    vector<Edge> byId(m);
+    parallel_for(1, n + 1, threads, [&](size_t first, size_t last, int) {
+        for (size_t u = first; u < last; ++u)
+        {
+            for (uint64_t e = graph.edgeBegin(static_cast<int>(u)); e < graph.edgeEnd(static_cast<int>(u)); ++e)
+            {
+                if (static_cast<int>(u) <= graph.target(e))
+                    byId[graph.edgeId(e)] = Edge(static_cast<int>(u), graph.target(e), graph.weight(e));
+            }
+        }
+    });
+
+    const int NONE = -1;
+    vector<int> component(n + 1);              // Raiz da componente de cada vertice
+    vector<atomic<int>> cheapest(n + 1);       // Id da aresta mais barata que sai de cada componente
+    for (int v = 0; v <= n; ++v)
+        component[v] = v;
+    ConcurrentUnionFind uf(n);
+    vector<vector<Edge>> chosen(threads); // Arestas aceitas por cada thread numa rodada
+
+    while (true)
+    {
+        // Cada rodada examina todas as meias-arestas
+        GRAPH_METRICS_ADD(VerticesTouched, n);
+        GRAPH_METRICS_ADD(EdgesTouched, 2 * static_cast<uint64_t>(m));
+        parallel_for(0, n + 1, threads, [&](size_t first, size_t last, int) {
+            for (size_t c = first; c < last; ++c)
+                cheapest[c].store(NONE, memory_order_relaxed);
+        });
+
+        // Cada thread percorre uma faixa de vertices e disputa o minimo de cada componente com CAS
+        parallel_for(1, n + 1, threads, [&](size_t first, size_t last, int) {
+            for (size_t u = first; u < last; ++u)
+            {
+                int c = component[u];
+                for (uint64_t e = graph.edgeBegin(static_cast<int>(u)); e < graph.edgeEnd(static_cast<int>(u)); ++e)
+                {
+                    if (component[graph.target(e)] == c)
+                        continue;
+                    int id = graph.edgeId(e);
+                    int current = cheapest[c].load(memory_order_relaxed);
+                    while ((current == NONE || edge_less(byId[id], byId[current])) &&
+                           !cheapest[c].compare_exchange_weak(current, id, memory_order_relaxed))
+                    {
+                    }
+                }
+            }
+        });
+
+        // Contracao em paralelo: a aresta minima de cada componente pertence a floresta (ordem
+        // total, sem empates); se duas componentes escolhem a mesma ligacao, so um unite vence
+        for (int t = 0; t < threads; ++t)
+            chosen[t].clear();
+        parallel_for(1, n + 1, threads, [&](size_t first, size_t last, int t) {
+            for (size_t c = first; c < last; ++c)
+            {
+                int id = cheapest[c].load(memory_order_relaxed);
+                if (id != NONE && uf.unite(byId[id].u, byId[id].v))
+                    chosen[t].push_back(byId[id]);
+            }
+        });
+        size_t before = T.size();
+        for (int t = 0; t < threads; ++t)
+            T.insert(T.end(), chosen[t].begin(), chosen[t].end());
+        if (T.size() == before)
+            break;
+
+        parallel_for(1, n + 1, threads, [&](size_t first, size_t last, int) {
+            for (size_t v = first; v < last; ++v)
+                component[v] = uf.find(static_cast<int>(v));
+        });
+    }
+
+    // Mesma ordem do Kruskal
+    parallel_sort(T, edge_less, threads);
+    return T;
+}
+
+vector<Edge> prim_mst_naive(const CsrGraph &graph)
+{
+    GRAPH_METRICS_SCOPE("prim_mst_naive");
+    int n = graph.getOrder();
+    vector<Edge> T;
+    if (n == 0)
+        return T;
+    vector<bool> in_tree(n + 1, false);
+    in_tree[1] = true;
+
+    for (int count = 1; count < n; ++count)
+    {
+        int min_weight = INT_MAX;
+        int u_min = -1, v_min = -1;
+        GRAPH_METRICS_ADD(VerticesTouched, n);
+        GRAPH_METRICS_ADD(EdgesTouched, 2 * static_cast<uint64_t>(graph.getSize()));
+
+        for (int u = 1; u <= n; ++u)
+        {
+            if (!in_tree[u]) continue;
+            for (uint64_t e = graph.edgeBegin(u); e < graph.edgeEnd(u); ++e)
+            {
+                int v = graph.target(e);
+                int w = graph.weight(e);
+                if (!in_tree[v] && w < min_weight)
+                {
+                    min_weight = w;
+                    u_min = u;
+                    v_min = v;
+                }
+            }
+        }
+
+        if (u_min != -1 && v_min != -1)
+        {
+            T.emplace_back(u_min, v_min, min_weight);
+            in_tree[v_min] = true;
+        }
+    }
+    return T;
+}
+
+vector<Edge> prim_mst(const Graph &graph)
+{
+    GRAPH_METRICS_SCOPE("prim_mst");
+    return prim_mst(graph.freeze());
+}
+
+vector<Edge> prim_mst_lazy(const Graph &graph)
+{
+    GRAPH_METRICS_SCOPE("prim_mst_lazy");
+    return prim_mst_lazy(graph.freeze());
+}
+
+vector<Edge> prim_mst(const CsrGraph &graph)
+{
+    GRAPH_METRICS_SCOPE("prim_mst");
+    int n = graph.getOrder();
+    // Cada vertice sai da heap uma vez e examina as suas meias-arestas
+    GRAPH_METRICS_ADD(VerticesTouched, n);
+    GRAPH_METRICS_ADD(EdgesTouched, 2 * static_cast<uint64_t>(graph.getSize()));
+    vector<Edge> T;
+    if (n == 0)
+        return T;
+    T.reserve(n - 1);
+    vector<bool> in_tree(n + 1, false);
+    vector<int> parent(n + 1, 0); // Vertice de Z ligado a v pela aresta mais barata da fronteira
+    IndexedHeap frontier(n + 1);  // Fronteira de Z, chave = custo dessa aresta
+
+    // Uma arvore por componente: a floresta geradora minima
+    for (int root = 1; root <= n; ++root)
+    {
+        if (in_tree[root])
+            continue;
+        frontier.push(root, 0);
+        while (!frontier.empty())
+        {
+            int w = static_cast<int>(frontier.topKey());
+            int u = frontier.pop();
+            in_tree[u] = true; // Z = Z U {u}
+            if (u != root)
+                T.emplace_back(parent[u], u, w); // T = T U {Aresta parent(u) u}
+
+            for (uint64_t e = graph.edgeBegin(u); e < graph.edgeEnd(u); ++e)
+            {
+                int v = graph.target(e);
+                if (!in_tree[v] && frontier.pushOrDecrease(v, graph.weight(e)))
+                    parent[v] = u;
+            }
+        }
+    }
+    return T;
+}
+
+vector<Edge> prim_mst_lazy(const CsrGraph &graph)
+{
+    GRAPH_METRICS_SCOPE("prim_mst_lazy");
+    int n = graph.getOrder();
+    GRAPH_METRICS_ADD(VerticesTouched, n);
+    GRAPH_METRICS_ADD(EdgesTouched, 2 * static_cast<uint64_t>(graph.getSize()));
+    vector<Edge> T;
+    if (n == 0)
+        return T;
+    T.reserve(n - 1);
+    vector<bool> in_tree(n + 1, false);
+
+    // Heap binaria de arestas da fronteira (custo, vertice fora de Z, vertice de Z)
+    using FrontierEdge = tuple<int, int, int>;
+    priority_queue<FrontierEdge, vector<FrontierEdge>, greater<FrontierEdge>> frontier;
+
+    for (int root = 1; root <= n; ++root)
+    {
+        if (in_tree[root])
+            continue;
+        frontier.emplace(0, root, 0);
+        GRAPH_METRICS_ADD(HeapOperations, 1);
+        while (!frontier.empty())
+        {
+            int w, v, u;
+            tie(w, v, u) = frontier.top();
+            frontier.pop();
+            GRAPH_METRICS_ADD(HeapOperations, 1);
+            // Remocao preguicosa: a aresta ficou dentro de Z
+            if (in_tree[v])
+                continue;
+            in_tree[v] = true;
+            if (u != 0)
+                T.emplace_back(u, v, w);
+
+            for (uint64_t e = graph.edgeBegin(v); e < graph.edgeEnd(v); ++e)
+            {
+                if (!in_tree[graph.target(e)])
+                {
+                    frontier.emplace(graph.weight(e), graph.target(e), v);
+                    GRAPH_METRICS_ADD(HeapOperations, 1);
+                }
+            }
+        }
+    }
+    return T;
+}
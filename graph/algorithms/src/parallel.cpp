@@ -0,0 +1,31 @@
+#include "parallel.hpp"
+#include <atomic>
+#include <cstdlib>
+
+namespace
+{
+    std::atomic<int> configuredThreads(0); // 0: usa o padrao
+
+    int default_thread_count()
+    {
+        const char *environment = std::getenv("GRAPH_THREADS");
+        if (environment != nullptr && std::atoi(environment) > 0)
+            return std::atoi(environment);
+        unsigned hardware = std::thread::hardware_concurrency();
+        return hardware > 0 ? static_cast<int>(hardware) : 1;
+    }
+} // namespace
+
+int get_thread_count()
+{
+    int threads = configuredThreads.load(std::memory_order_relaxed);
+    if (threads > 0)
+        return threads;
+    static const int defaultThreads = default_thread_count();
+    return defaultThreads;
+}
+
+void set_thread_count(int threads)
+{
+    configuredThreads.store(threads > 0 ? threads : 0, std::memory_order_relaxed);
+}
@@ -0,0 +1,217 @@
+#include "parallel_bfs.hpp"
+#include "parallel.hpp"
+#include "metrics.hpp"
+
+using namespace std;
+
+const int ParallelBfs::ALPHA;
+const int ParallelBfs::BETA;
+
+ParallelBfs::ParallelBfs(const CsrGraph &graph, int threads)
+    : graph(graph), threads(resolve_thread_count(threads)),
+      visitedBits((graph.getOrder() + 64) / 64), frontierBits(visitedBits.size()), nextBits(visitedBits.size()),
+      depth(graph.getOrder() + 1, -1), localQueues(this->threads), localFound(this->threads), localSlots(this->threads)
+{
+    clear();
+}
+
+void ParallelBfs::clear()
+{
+    int n = graph.getOrder();
+    zero(visitedBits);
+    fill(depth.begin(), depth.end(), -1);
+    // O indice 0 e os bits depois de n ficam marcados, assim palavras cheias indicam que nao ha o que visitar
+    visitedBits[0].fetch_or(1, memory_order_relaxed);
+    for (int v = n + 1; v < static_cast<int>(visitedBits.size()) * 64; ++v)
+        claim(visitedBits, v);
+    unexploredSlots = static_cast<int64_t>(graph.edgeEnd(n) - graph.edgeBegin(1));
+    frontier.clear();
+}
+
+void ParallelBfs::block(int vertex)
+{
+    if (claim(visitedBits, vertex))
+        unexploredSlots -= graph.getVertexDegree(vertex);
+}
+
+bool ParallelBfs::claim(Bitmap &bits, int vertex)
+{
+    uint64_t mask = uint64_t(1) << (vertex & 63);
+    return !(bits[vertex >> 6].fetch_or(mask, memory_order_relaxed) & mask);
+}
+
+void ParallelBfs::zero(Bitmap &bits)
+{
+    parallel_for(0, bits.size(), threads, [&](size_t first, size_t last, int) {
+        for (size_t w = first; w < last; ++w)
+            bits[w].store(0, memory_order_relaxed);
+    }, 1 << 14);
+}
+
+int ParallelBfs::run(int source)
+{
+    GRAPH_METRICS_SCOPE("parallel_bfs");
+    int n = graph.getOrder();
+    if (visited(source))
+        return 0;
+    claim(visitedBits, source);
+    depth[source] = 0;
+    unexploredSlots -= graph.getVertexDegree(source);
+    frontier.assign(1, source);
+
+    int64_t total = 1;
+    int64_t frontierSize = 1;
+    int64_t frontierSlots = graph.getVertexDegree(source);
+    int64_t previousSize = 0;
+    bool bottomUp = false;
+    for (int level = 1; frontierSize > 0; ++level)
+    {
+        // Heuristica de troca de direcao de Beamer
+        if (!bottomUp)
+        {
+            if (!graph.isDirected() && frontierSlots > unexploredSlots / ALPHA && frontierSize >= previousSize)
+            {
+                queueToBitmap();
+                bottomUp = true;
+            }
+        }
+        else if (frontierSize < n / BETA && frontierSize < previousSize)
+        {
+            bitmapToQueue();
+            bottomUp = false;
+        }
+
+        int64_t found = 0, foundSlots = 0;
+        if (bottomUp)
+            bottomUpStep(level, found, foundSlots);
+        else
+            topDownStep(level, found, foundSlots);
+
+        unexploredSlots -= foundSlots;
+        total += found;
+        previousSize = frontierSize;
+        frontierSize = found;
+        frontierSlots = foundSlots;
+    }
+    frontier.clear();
+    return static_cast<int>(total);
+}
+
+void ParallelBfs::topDownStep(int nextLevel, int64_t &found, int64_t &foundSlots)
+{
+    for (int t = 0; t < threads; ++t)
+    {
+        localQueues[t].clear();
+        localSlots[t] = 0;
+    }
+
+    // Cada thread expande um pedaco da fronteira; o fetch_or decide quem descobre cada vertice
+    parallel_for(0, frontier.size(), threads, [&](size_t first, size_t last, int t) {
+        vector<int> &queue = localQueues[t];
+        int64_t slots = 0;
+        uint64_t scanned = 0;
+        for (size_t i = first; i < last; ++i)
+        {
+            int u = frontier[i];
+            scanned += graph.getVertexDegree(u);
+            for (uint64_t e = graph.edgeBegin(u); e < graph.edgeEnd(u); ++e)
+            {
+                int w = graph.target(e);
+                if (!test(visitedBits, w) && claim(visitedBits, w))
+                {
+                    depth[w] = nextLevel;
+                    queue.push_back(w);
+                    slots += graph.getVertexDegree(w);
+                }
+            }
+        }
+        localSlots[t] = slots;
+        GRAPH_METRICS_ADD(VerticesTouched, last - first);
+        GRAPH_METRICS_ADD(EdgesTouched, scanned);
+    }, 256);
+
+    frontier.clear();
+    for (int t = 0; t < threads; ++t)
+    {
+        frontier.insert(frontier.end(), localQueues[t].begin(), localQueues[t].end());
+        foundSlots += localSlots[t];
+    }
+    found = static_cast<int64_t>(frontier.size());
+}
+
+void ParallelBfs::bottomUpStep(int nextLevel, int64_t &found, int64_t &foundSlots)
+{
+    zero(nextBits);
+    for (int t = 0; t < threads; ++t)
+        localFound[t] = localSlots[t] = 0;
+
+    // Cada vertice nao visitado procura um vizinho na fronteira e para no primeiro
+    parallel_for(0, visitedBits.size(), threads, [&](size_t first, size_t last, int t) {
+        int64_t count = 0, slots = 0;
+        uint64_t examined = 0, scanned = 0;
+        for (size_t word = first; word < last; ++word)
+        {
+            uint64_t pending = ~visitedBits[word].load(memory_order_relaxed);
+            while (pending)
+            {
+                int v = static_cast<int>(word * 64) + __builtin_ctzll(pending);
+                pending &= pending - 1;
+                ++examined;
+                for (uint64_t e = graph.edgeBegin(v); e < graph.edgeEnd(v); ++e)
+                {
+                    ++scanned;
+                    if (test(frontierBits, graph.target(e)))
+                    {
+                        claim(visitedBits, v);
+                        claim(nextBits, v);
+                        depth[v] = nextLevel;
+                        ++count;
+                        slots += graph.getVertexDegree(v);
+                        break;
+                    }
+                }
+            }
+        }
+        localFound[t] = count;
+        localSlots[t] = slots;
+        GRAPH_METRICS_ADD(VerticesTouched, examined);
+        GRAPH_METRICS_ADD(EdgesTouched, scanned);
+    }, 64);
+
+    for (int t = 0; t < threads; ++t)
+    {
+        found += localFound[t];
+        foundSlots += localSlots[t];
+    }
+    frontierBits.swap(nextBits);
+}
+
+void ParallelBfs::queueToBitmap()
+{
+    zero(frontierBits);
+    parallel_for(0, frontier.size(), threads, [&](size_t first, size_t last, int) {
+        for (size_t i = first; i < last; ++i)
+            claim(frontierBits, frontier[i]);
+    });
+}
+
+void ParallelBfs::bitmapToQueue()
+{
+    for (int t = 0; t < threads; ++t)
+        localQueues[t].clear();
+    parallel_for(0, frontierBits.size(), threads, [&](size_t first, size_t last, int t) {
+        for (size_t word = first; word < last; ++word)
+        {
+            uint64_t bits = frontierBits[word].load(memory_order_relaxed);
+            while (bits)
+            {
+                localQueues[t].push_back(static_cast<int>(word * 64) + __builtin_ctzll(bits));
+                bits &= bits - 1;
+            }
+        }
+    }, 1024);
+
+    frontier.clear();
+    for (int t = 0; t < threads; ++t)
+        frontier.insert(frontier.end(), localQueues[t].begin(), localQueues[t].end());
+}
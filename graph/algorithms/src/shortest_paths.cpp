@@ -0,0 +1,90 @@
+#include "shortest_paths.hpp"
+#include "indexed_heap.hpp"
+#include "metrics.hpp"
+#include <algorithm>
+
+constexpr std::int64_t ShortestPaths::UNREACHABLE;
+
+vector<int> ShortestPaths::path_to(int v) const
+{
+    vector<int> path;
+    if (!reached(v))
+        return path;
+    for (int u = v; u != 0; u = predecessor[u])
+        path.push_back(u);
+    reverse(path.begin(), path.end());
+    return path;
+}
+
+namespace
+{
+    /**
+     * @brief Dijkstra over any graph type; forEachArc(u, f) calls f(v, weight) for every arc u -> v
+     * @param target Vertex that stops the search once settled, or 0 to settle every vertex
+     */
+    template <typename ForEachArc>
+    ShortestPaths run_dijkstra(int n, int source, int target, ForEachArc forEachArc)
+    {
+        ShortestPaths result;
+        result.source = source;
+        result.distance.assign(n + 1, ShortestPaths::UNREACHABLE);
+        result.predecessor.assign(n + 1, 0);
+        if (source < 1 || source > n)
+            return result;
+
+        IndexedHeap heap(n + 1);
+        uint64_t settled = 0, relaxed = 0;
+        result.distance[source] = 0;
+        heap.push(source, 0);
+        while (!heap.empty())
+        {
+            std::int64_t d = heap.topKey();
+            int u = heap.pop();
+            ++settled;
+            // O destino foi fixado: o caminho ate ele nao muda mais
+            if (u == target)
+                break;
+            forEachArc(u, [&](int v, int weight) {
+                ++relaxed;
+                std::int64_t candidate = d + weight;
+                if (candidate < result.distance[v])
+                {
+                    result.distance[v] = candidate;
+                    result.predecessor[v] = u;
+                    heap.pushOrDecrease(v, candidate);
+                }
+            });
+        }
+        GRAPH_METRICS_ADD(VerticesTouched, settled);
+        GRAPH_METRICS_ADD(EdgesTouched, relaxed);
+        return result;
+    }
+} // namespace
+
+ShortestPaths dijkstra(const CsrGraph &graph, int source)
+{
+    return dijkstra(graph, source, 0);
+}
+
+ShortestPaths dijkstra(const CsrGraph &graph, int source, int target)
+{
+    GRAPH_METRICS_SCOPE("dijkstra");
+    return run_dijkstra(graph.getOrder(), source, target, [&graph](int u, auto &&relax) {
+        for (uint64_t e = graph.edgeBegin(u); e < graph.edgeEnd(u); ++e)
+            relax(graph.target(e), graph.weight(e));
+    });
+}
+
+ShortestPaths dijkstra(const Graph &graph, int source)
+{
+    return dijkstra(graph, source, 0);
+}
+
+ShortestPaths dijkstra(const Graph &graph, int source, int target)
+{
+    GRAPH_METRICS_SCOPE("dijkstra");
+    return run_dijkstra(graph.getOrder(), source, target, [&graph](int u, auto &&relax) {
+        for (auto current = graph.getAdjacencyList(u); current != nullptr; current = current->next)
+            relax(current->vertex, current->weight);
+    });
+}
@@ -1,71 +1,96 @@
 #include "trails.hpp"
+#include "bridges.hpp"
+#include "metrics.hpp"
+#include <algorithm>
+#include <cstdint>
 
 
-EulerianTrailProperties getEulerianPropetiesOfGraph(const Graph &graph)
+namespace
 {
-    // An undirected graph is Eulerian if all vertices with nonzero degree have even degree, or if the graph has exactaly 2 vertices with odd degree
-    // and all vertices with nonzero degree are connected.
-    EulerianTrailProperties properties;
-    int oddDegreeCount = 0;
-    int n = graph.getOrder();
-    int nonZeroDegreeVertex = -1;
-
-    // Find a vertex with nonzero degree to start bfs
-    for (int i = 0; i < n; ++i)
+    // Graph e CsrGraph: so precisa de getOrder, getVertexDegree e bfs
+    template <typename GraphType>
+    EulerianTrailProperties eulerian_properties(const GraphType &graph)
     {
-        if (graph.getVertexDegree(i) > 0)
+        // An undirected graph is Eulerian if all vertices with nonzero degree have even degree, or if the graph has exactaly 2 vertices with odd degree
+        // and all vertices with nonzero degree are connected.
+        EulerianTrailProperties properties;
+        int oddDegreeCount = 0;
+        int n = graph.getOrder();
+        int nonZeroDegreeVertex = -1;
+        GRAPH_METRICS_ADD(VerticesTouched, n);
+
+        // Find a vertex with nonzero degree to start bfs
+        for (int i = 1; i <= n; ++i)
         {
-            nonZeroDegreeVertex = i;
-            break;
+            if (graph.getVertexDegree(i) > 0)
+            {
+                nonZeroDegreeVertex = i;
+                break;
+            }
         }
-    }
-    if (nonZeroDegreeVertex == -1)
-    {
-        // No edges in the graph
-        // return false;
-        properties.isEulerian = false;
-        return properties;
-    }
-
-    // Check all vertices have even degree
-    for (int i = 0; i < n; ++i)
-    {
-        if (graph.getVertexDegree(i) % 2 != 0)
+        if (nonZeroDegreeVertex == -1)
         {
-            oddDegreeCount++;
-            oddDegreeCount == 1 ? properties.startTAE = i : properties.endTAE = i;
+            // No edges in the graph
+            // return false;
+            properties.isEulerian = false;
+            return properties;
         }
-    }
 
-    if (oddDegreeCount != 2 && oddDegreeCount != 0)
-    {
-        properties.isEulerian = false; // More than 2 vertices with odd degree
-        // properties.hasTAE = false; // No TAE trail
-        // properties.hasTFE = false; // No TFE trail
-        return properties;
-    }
+        // Check all vertices have even degree
+        for (int i = 1; i <= n; ++i)
+        {
+            if (graph.getVertexDegree(i) % 2 != 0)
+            {
+                oddDegreeCount++;
+                oddDegreeCount == 1 ? properties.startTAE = i : properties.endTAE = i;
+            }
+        }
 
-    // Check if all nonzero degree vertices are connected
-    vector<bool> visited(n, false);
-    bfs(graph,nonZeroDegreeVertex,visited);
-   
-    properties.startTFE = nonZeroDegreeVertex;
-    for (int i = 0; i < n; ++i)
-    {
-        if (graph.getVertexDegree(i) > 0 && !visited[i])
+        if (oddDegreeCount != 2 && oddDegreeCount != 0)
         {
-            properties.isEulerian = false; // Found a nonzero degree vertex that is not connected
+            properties.isEulerian = false; // More than 2 vertices with odd degree
+            // properties.hasTAE = false; // No TAE trail
+            // properties.hasTFE = false; // No TFE trail
             return properties;
         }
+
+        // Check if all nonzero degree vertices are connected
+        vector<bool> visited(n + 1, false);
+        bfs(graph,nonZeroDegreeVertex,visited);
+
+        properties.startTFE = nonZeroDegreeVertex;
+        for (int i = 1; i <= n; ++i)
+        {
+            if (graph.getVertexDegree(i) > 0 && !visited[i])
+            {
+                properties.isEulerian = false; // Found a nonzero degree vertex that is not connected
+                return properties;
+            }
+        }
+
+        properties.isEulerian = true; // All conditions for Eulerian trail are satisfied
+        oddDegreeCount == 0 ? properties.hasTFE = true : properties.hasTAE = true;
+        return properties;
     }
+} // namespace
+
+EulerianTrailProperties getEulerianPropetiesOfGraph(const Graph &graph)
+{
+    GRAPH_METRICS_SCOPE("eulerian_properties");
+    // Paridade dos graus e conexidade: uma vez por versao do grafo
+    return *graph.memoize<EulerianTrailProperties>(DerivedProperty::EulerianProperties,
+                                                   [&graph]() { return eulerian_properties(graph); });
+}
 
-    properties.isEulerian = true; // All conditions for Eulerian trail are satisfied
-    oddDegreeCount == 0 ? properties.hasTFE = true : properties.hasTAE = true;
-    return properties;
+EulerianTrailProperties getEulerianPropetiesOfGraph(const CsrGraph &graph)
+{
+    GRAPH_METRICS_SCOPE("eulerian_properties");
+    return eulerian_properties(graph);
 }
 
 vector<Edge> fleury_algorithm(const Graph &graph, EulerianTrailProperties &properties)
 {
+    GRAPH_METRICS_SCOPE("fleury_algorithm");
     vector<Edge> trail;      // Keeps edges in order of traversal
     Graph graphCopy = graph; // Cópia para manipulação
     int startVertex = properties.hasTAE ? properties.startTAE : properties.startTFE;
@@ -73,25 +98,27 @@ vector<Edge> fleury_algorithm(const Graph &graph, EulerianTrailProperties &prope
 
     while (graphCopy.getVertexDegree(currentVertex) > 0)
     {
-        // Procura uma aresta que não seja ponte
-        auto adj = graphCopy.getAdjacencyList(currentVertex);
+        // Procura uma aresta que não seja ponte, com as pontes do grafo restante
+        // calculadas uma vez por passo, sem modificar o grafo
+        Biconnectivity remaining = find_bridges(graphCopy);
         int nextVertex = -1;
-        while (adj != nullptr)
+        int nextWeight = 1;
+        for (auto adj = graphCopy.getAdjacencyList(currentVertex); adj != nullptr; adj = adj->next)
         {
-            int candidate = adj->vertex;
             // Se só existe uma aresta, tem que ser ela
-            if (graphCopy.getVertexDegree(currentVertex) == 1 || !isBridge(graphCopy, currentVertex, candidate))
+            if (graphCopy.getVertexDegree(currentVertex) == 1 || !remaining.is_bridge(currentVertex, adj->vertex))
             {
-                nextVertex = candidate;
+                nextVertex = adj->vertex;
+                nextWeight = adj->weight;
                 break;
             }
-            adj = adj->next;
         }
         if (nextVertex == -1)
             break; // Nenhuma aresta disponível
 
-        // Adiciona a aresta ao trilha
-        trail.push_back(Edge(currentVertex, nextVertex, 1));
+        // Adiciona a aresta ao trilha, com o peso real (o mesmo que o Hierholzer devolve); removeEdge
+        // tira justamente este no, o primeiro para nextVertex na lista
+        trail.push_back(Edge(currentVertex, nextVertex, nextWeight));
         // Remove a aresta do grafo
         graphCopy.removeEdge(currentVertex, nextVertex);
         // Avança para o próximo vértice
@@ -99,4 +126,71 @@ vector<Edge> fleury_algorithm(const Graph &graph, EulerianTrailProperties &prope
     }
 
     return trail;
-}
\ No newline at end of file
+}
+
+vector<Edge> hierholzer_algorithm(const Graph &graph, EulerianTrailProperties &properties)
+{
+    GRAPH_METRICS_SCOPE("hierholzer_algorithm");
+    return hierholzer_algorithm(graph.freeze(), properties);
+}
+
+vector<Edge> hierholzer_algorithm(const CsrGraph &graph, const EulerianTrailProperties &properties)
+{
+    GRAPH_METRICS_SCOPE("hierholzer_algorithm");
+    vector<Edge> trail;
+    if (!properties.isEulerian)
+        return trail;
+    // Os cursores passam uma vez por cada meia-aresta
+    GRAPH_METRICS_ADD(VerticesTouched, graph.getOrder());
+    GRAPH_METRICS_ADD(EdgesTouched, 2 * static_cast<uint64_t>(graph.getSize()));
+    trail.reserve(graph.getSize());
+
+    int n = graph.getOrder();
+    vector<uint64_t> cursor(n + 1);          // Proxima meia-aresta a tentar em cada vertice
+    for (int v = 1; v <= n; ++v)
+        cursor[v] = graph.edgeBegin(v);
+    vector<bool> used(graph.getSize(), false); // Arestas ja percorridas, pelo id
+
+    // Pilha com o vertice atual e a meia-aresta usada para chegar nele
+    struct Step
+    {
+        int vertex;
+        uint64_t slot;
+    };
+    const uint64_t NO_SLOT = UINT64_MAX;
+    vector<Step> stack;
+    stack.push_back({properties.hasTAE ? properties.startTAE : properties.startTFE, NO_SLOT});
+
+    while (!stack.empty())
+    {
+        int v = stack.back().vertex;
+        uint64_t &next = cursor[v];
+        while (next < graph.edgeEnd(v) && used[graph.edgeId(next)])
+            ++next;
+
+        if (next < graph.edgeEnd(v))
+        {
+            // Segue por uma aresta ainda nao usada
+            used[graph.edgeId(next)] = true;
+            stack.push_back({graph.target(next), next});
+            ++next;
+            continue;
+        }
+
+        // Sem arestas livres: o vertice fecha um pedaco da trilha, que sai em ordem inversa
+        Step step = stack.back();
+        stack.pop_back();
+        if (step.slot != NO_SLOT)
+            trail.push_back(Edge(stack.back().vertex, step.vertex, graph.weight(step.slot)));
+    }
+
+    reverse(trail.begin(), trail.end());
+    return trail;
+}
+
+vector<Edge> eulerian_trail(const Graph &graph, EulerianTrailProperties &properties, EulerianTrailAlgorithm algorithm)
+{
+    if (algorithm == EulerianTrailAlgorithm::Fleury)
+        return fleury_algorithm(graph, properties);
+    return hierholzer_algorithm(graph, properties);
+}
@@ -1,30 +1,17 @@
 #include "utils.hpp"
+#include "bridges.hpp"
+#include "parallel_bfs.hpp"
+#include "metrics.hpp"
 
 void bfs(const Graph &graph, int vertice, vector<bool> &visited)
 {
-    visited[vertice] = true;
-    queue<int> queue;
-    queue.push(vertice);
-    while (!queue.empty())
-    {
-        int u = queue.front();
-        queue.pop();
-        auto current = graph.getAdjacencyList(u);
-        // Fazendo a travecia na lista ligada
-        while (current != nullptr)
-        {
-            int w = current->vertex;
-            current = current->next;
-            if (visited[w] == false)
-            {
-                visited[w] = true;
-                queue.push(w);
-            }
-        }
-    }
+    GRAPH_METRICS_SCOPE("bfs");
+    bfs(graph.freeze(), vertice, visited);
 }
 
 void dfs(const Graph &graph, int vertice, vector<bool> &visited){
+    GRAPH_METRICS_SCOPE("dfs");
+    uint64_t expanded = 0, scanned = 0;
     visited[vertice] = true;
     stack<int> s;
     s.push(vertice);
@@ -32,9 +19,11 @@ void dfs(const Graph &graph, int vertice, vector<bool> &visited){
     {
         int u = s.top();
         s.pop();
+        ++expanded;
         auto current = graph.getAdjacencyList(u);
         while(current!=nullptr)
         {
+            ++scanned;
             int w = current->vertex;
             current = current->next;
             if(!visited[w])
@@ -44,20 +33,54 @@ void dfs(const Graph &graph, int vertice, vector<bool> &visited){
             }
         }
     }
+    GRAPH_METRICS_ADD(VerticesTouched, expanded);
+    GRAPH_METRICS_ADD(EdgesTouched, scanned);
 }
 
-bool isBridge(Graph &graph, int u, int v)
+void bfs(const CsrGraph &graph, int vertice, vector<bool> &visited)
 {
-    // Remove a aresta (u, v) temporariamente
-    graph.removeEdge(u, v);
-    // Faz uma busca em largura (BFS) ou profundidade (DFS) a partir de u
-    // e verifica se v é alcançável
-    
-    vector<bool> visited(graph.getOrder(), false);
-    bfs(graph, u, visited);
+    GRAPH_METRICS_SCOPE("bfs");
+    // Vertices ja marcados funcionam como barreiras, como na versao sequencial
+    int n = graph.getOrder();
+    ParallelBfs search(graph);
+    for (int v = 1; v <= n; ++v)
+    {
+        if (visited[v])
+            search.block(v);
+    }
+    search.run(vertice);
+    for (int v = 1; v <= n; ++v)
+        visited[v] = search.visited(v);
+}
 
-    // Recoloca a aresta (u, v)
-    graph.addEdge(u, v);
-    // Se v não foi visitado, então (u, v) é ponte
-    return !visited[v];
-};
+void dfs(const CsrGraph &graph, int vertice, vector<bool> &visited)
+{
+    GRAPH_METRICS_SCOPE("dfs");
+    uint64_t expanded = 0, scanned = 0;
+    visited[vertice] = true;
+    vector<int> s;
+    s.push_back(vertice);
+    while (!s.empty())
+    {
+        int u = s.back();
+        s.pop_back();
+        ++expanded;
+        scanned += graph.getVertexDegree(u);
+        for (int w : graph.neighbors(u))
+        {
+            if (!visited[w])
+            {
+                visited[w] = true;
+                s.push_back(w);
+            }
+        }
+    }
+    GRAPH_METRICS_ADD(VerticesTouched, expanded);
+    GRAPH_METRICS_ADD(EdgesTouched, scanned);
+}
+
+bool isBridge(const Graph &graph, int u, int v)
+{
+    GRAPH_METRICS_SCOPE("isBridge");
+    return memoized_bridges(graph)->is_bridge(u, v);
+}
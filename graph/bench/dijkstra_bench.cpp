@@ -0,0 +1,64 @@
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <string>
+#include "csr_graph.hpp"
+#include "edge_list_reader.hpp"
+#include "shortest_paths.hpp"
+using namespace std;
+
+/**
+ * @brief Runs the library Dijkstra on a "n m s t" arc list, printing the path like algorithms/cfiles/dijkstra.c
+ *
+ * The search is repeated to get a stable time per query, which goes to stderr so stdout can be
+ * compared with the output of the C program (target dijkstra_c).
+ */
+int main(int argc, char const *argv[])
+{
+    if (argc < 2)
+    {
+        cerr << "Usage: " << argv[0] << " <input_file_path> [repetitions]" << endl;
+        return 1;
+    }
+    int repetitions = argc > 2 ? atoi(argv[2]) : 1;
+    if (repetitions < 1)
+        repetitions = 1;
+
+    EdgeListHeader header;
+    vector<Edge> arcs;
+    if (!read_edge_list(argv[1], true, header, arcs))
+        return 1;
+    if (header.source < 1 || header.target < 1)
+    {
+        cerr << "Error: " << argv[1] << " has no source and target (first line must be: n m s t)" << endl;
+        return 1;
+    }
+
+    auto buildStart = chrono::steady_clock::now();
+    CsrGraph graph = CsrGraph::arcs(header.numVertices, arcs, true);
+    double buildSeconds = chrono::duration<double>(chrono::steady_clock::now() - buildStart).count();
+
+    ShortestPaths paths;
+    auto start = chrono::steady_clock::now();
+    for (int i = 0; i < repetitions; ++i)
+        paths = dijkstra(graph, header.source, header.target);
+    double seconds = chrono::duration<double>(chrono::steady_clock::now() - start).count();
+
+    vector<int> path = paths.path_to(header.target);
+    if (path.empty())
+    {
+        cout << "Não existe caminho de " << header.source << " até " << header.target << endl;
+    }
+    else
+    {
+        cout << "Caminho minimo do vertice " << header.source << " para o vertice " << header.target << ":";
+        for (size_t i = 1; i < path.size(); ++i)
+            cout << " (" << path[i - 1] << ", " << path[i] << ")";
+        cout << endl
+             << "Custo: " << paths.distance[header.target] << endl;
+    }
+
+    cerr << "CSR: " << buildSeconds * 1e6 << " us; Dijkstra: " << seconds / repetitions * 1e6
+         << " us por busca (" << repetitions << " repeticoes)" << endl;
+    return path.empty() ? 1 : 0;
+}
@@ -0,0 +1,400 @@
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <functional>
+#include <iostream>
+#include <new>
+#include <random>
+#include <string>
+#include <sys/resource.h>
+#include "connected.hpp"
+#include "dynamic_connectivity.hpp"
+#include "graph_generators.hpp"
+#include "graph.hpp"
+#include "minimum_spanning_tree.hpp"
+#include "parallel.hpp"
+#include "shortest_paths.hpp"
+#include "trails.hpp"
+#include "utils.hpp"
+using namespace std;
+
+/*
+ * Contagem de alocacoes: o operator new global deste executavel conta chamadas e bytes.
+ * Os contadores sao atomicos porque os algoritmos paralelos alocam em varias threads.
+ */
+namespace
+{
+    atomic<uint64_t> allocationCount(0);
+    atomic<uint64_t> allocatedBytes(0);
+}
+
+void *operator new(size_t size)
+{
+    allocationCount.fetch_add(1, memory_order_relaxed);
+    allocatedBytes.fetch_add(size, memory_order_relaxed);
+    if (void *pointer = malloc(size ? size : 1))
+        return pointer;
+    throw bad_alloc();
+}
+
+void *operator new[](size_t size)
+{
+    return operator new(size);
+}
+
+void operator delete(void *pointer) noexcept { free(pointer); }
+void operator delete[](void *pointer) noexcept { free(pointer); }
+void operator delete(void *pointer, size_t) noexcept { free(pointer); }
+void operator delete[](void *pointer, size_t) noexcept { free(pointer); }
+
+namespace
+{
+    /**
+     * @brief Shape of the synthetic input of a benchmark
+     */
+    enum class InputKind
+    {
+        Random,   // G(n, m) with n = m / 8 (average degree 16), weights 1..1000
+        Forest,   // Random tree with m + 1 vertices
+        Eulerian  // Generator family "eulerian" with n = m / 8: every degree is even
+    };
+
+    /**
+     * @brief Input shared by every repetition of a benchmark at one size
+     */
+    struct Workload
+    {
+        int vertices;
+        vector<Edge> edges;
+        Graph graph;
+    };
+
+    /**
+     * @brief What one timed section measured
+     */
+    struct Sample
+    {
+        double seconds;
+        uint64_t allocations;
+        uint64_t bytes;
+    };
+
+    /**
+     * @brief One benchmark: run(workload) times its own section with timed() and returns the sample
+     */
+    struct Benchmark
+    {
+        string name;
+        InputKind kind;
+        uint64_t maxEdges;   // Largest size worth running (the naive algorithms are quadratic)
+        int operations;      // Operations per timed section (ns/edge is divided by it)
+        function<Sample(Workload &)> run;
+    };
+
+    volatile int64_t sink = 0; // Impede que o compilador descarte os resultados
+
+    template <typename Body>
+    Sample timed(Body body)
+    {
+        uint64_t allocationsBefore = allocationCount.load(memory_order_relaxed);
+        uint64_t bytesBefore = allocatedBytes.load(memory_order_relaxed);
+        auto start = chrono::steady_clock::now();
+        body();
+        double seconds = chrono::duration<double>(chrono::steady_clock::now() - start).count();
+        return Sample{seconds, allocationCount.load(memory_order_relaxed) - allocationsBefore,
+                      allocatedBytes.load(memory_order_relaxed) - bytesBefore};
+    }
+
+    Workload make_workload(InputKind kind, uint64_t edges, uint32_t seed)
+    {
+        Workload workload;
+        int m = static_cast<int>(edges);
+        if (kind == InputKind::Forest)
+        {
+            mt19937 random(seed);
+            workload.vertices = m + 1;
+            for (int v = 2; v <= workload.vertices; ++v)
+                workload.edges.emplace_back(static_cast<int>(random() % (v - 1)) + 1, v, static_cast<int>(random() % 1000) + 1);
+        }
+        else
+        {
+            GraphSpec spec;
+            spec.family = kind == InputKind::Random ? GraphFamily::Gnm : GraphFamily::Eulerian;
+            spec.vertices = static_cast<uint64_t>(max(16, m / 8));
+            spec.edges = edges;
+            spec.maxWeight = kind == InputKind::Random ? 1000 : 0;
+            spec.seed = seed;
+            workload.vertices = static_cast<int>(spec.vertices);
+            generate_graph(spec, [&workload](const Edge *batch, size_t count) {
+                workload.edges.insert(workload.edges.end(), batch, batch + count);
+                return true;
+            });
+        }
+        workload.graph = Graph(workload.vertices, true);
+        workload.graph.addEdges(workload.edges);
+        return workload;
+    }
+
+    vector<Benchmark> benchmarks()
+    {
+        const uint64_t ANY = UINT64_MAX;
+        const int REMOVED_VERTICES = 16;
+        const int BULK_REMOVED_VERTICES = 64;
+        const int DYNAMIC_UPDATES = 1024;
+        const int RECOMPUTED_UPDATES = 16;
+        return {
+            {"is_connected", InputKind::Random, ANY, 1, [](Workload &w) { return timed([&] { sink += is_connected(w.graph); }); }},
+            {"connected_component_amount", InputKind::Random, ANY, 1, [](Workload &w) { return timed([&] { sink += connected_component_amount(w.graph); }); }},
+            {"component_labels", InputKind::Random, ANY, 1, [](Workload &w) { return timed([&] { sink += component_labels(w.graph).count; }); }},
+            {"is_forest", InputKind::Forest, ANY, 1, [](Workload &w) { return timed([&] { sink += is_forest(w.graph); }); }},
+            {"kruskal_mst_naive", InputKind::Random, 1 << 12, 1, [](Workload &w) { return timed([&] { sink += kruskal_mst_naive(w.graph).size(); }); }},
+            {"kruskal_mst_paint", InputKind::Random, 1 << 16, 1, [](Workload &w) { return timed([&] { sink += kruskal_mst_paint(w.graph).size(); }); }},
+            {"kruskal_mst", InputKind::Random, ANY, 1, [](Workload &w) { return timed([&] { sink += kruskal_mst(w.graph).size(); }); }},
+            {"filter_kruskal_mst", InputKind::Random, ANY, 1, [](Workload &w) { return timed([&] { sink += filter_kruskal_mst(w.graph).size(); }); }},
+            {"boruvka_mst", InputKind::Random, ANY, 1, [](Workload &w) { return timed([&] { sink += boruvka_mst(w.graph).size(); }); }},
+            {"prim_mst_naive", InputKind::Random, 1 << 14, 1, [](Workload &w) { return timed([&] { sink += prim_mst_naive(w.graph).size(); }); }},
+            {"prim_mst", InputKind::Random, ANY, 1, [](Workload &w) { return timed([&] { sink += prim_mst(w.graph).size(); }); }},
+            {"dijkstra", InputKind::Random, ANY, 1, [](Workload &w) { return timed([&] { sink += dijkstra(w.graph, 1).distance.size(); }); }},
+            {"fleury_algorithm", InputKind::Eulerian, 1 << 11, 1, [](Workload &w) {
+                 EulerianTrailProperties properties = getEulerianPropetiesOfGraph(w.graph);
+                 return timed([&] { sink += fleury_algorithm(w.graph, properties).size(); });
+             }},
+            {"hierholzer_algorithm", InputKind::Eulerian, ANY, 1, [](Workload &w) {
+                 EulerianTrailProperties properties = getEulerianPropetiesOfGraph(w.graph);
+                 return timed([&] { sink += hierholzer_algorithm(w.graph, properties).size(); });
+             }},
+            {"memoized_queries", InputKind::Random, ANY, 5, [](Workload &w) {
+                 // Consultas repetidas num grafo que nao mudou: respondem dos resultados memoizados
+                 sink += is_connected(w.graph) + getEulerianPropetiesOfGraph(w.graph).isEulerian + isBridge(w.graph, 1, 2);
+                 return timed([&] {
+                     sink += is_connected(w.graph) + connected_component_amount(w.graph) + is_forest(w.graph) +
+                             getEulerianPropetiesOfGraph(w.graph).isEulerian + isBridge(w.graph, 1, 2);
+                 });
+             }},
+            {"dynamic_connectivity", InputKind::Random, ANY, DYNAMIC_UPDATES, [=](Workload &w) {
+                 DynamicConnectivity dynamic(w.graph);
+                 mt19937 random(7);
+                 return timed([&] {
+                     // Remove uma aresta, consulta e devolve: cada rodada sao duas atualizacoes
+                     for (int i = 0; i < DYNAMIC_UPDATES; ++i)
+                     {
+                         const Edge &edge = w.edges[random() % w.edges.size()];
+                         dynamic.removeEdge(edge.u, edge.v);
+                         sink += dynamic.connected(edge.u, edge.v) + dynamic.componentCount();
+                         dynamic.addEdge(edge.u, edge.v);
+                     }
+                 });
+             }},
+            {"dynamic_connectivity_forest", InputKind::Forest, ANY, DYNAMIC_UPDATES, [=](Workload &w) {
+                 // Numa floresta toda remocao e de aresta de arvore e nao tem substituta
+                 DynamicConnectivity dynamic(w.graph);
+                 mt19937 random(7);
+                 return timed([&] {
+                     for (int i = 0; i < DYNAMIC_UPDATES; ++i)
+                     {
+                         const Edge &edge = w.edges[random() % w.edges.size()];
+                         dynamic.removeEdge(edge.u, edge.v);
+                         sink += dynamic.connected(edge.u, edge.v) + dynamic.componentCount();
+                         dynamic.addEdge(edge.u, edge.v);
+                     }
+                 });
+             }},
+            {"recompute_after_update", InputKind::Random, 1 << 18, RECOMPUTED_UPDATES, [=](Workload &w) {
+                 // O que DynamicConnectivity evita: rotular o grafo de novo a cada mudanca
+                 Graph copy(w.graph);
+                 mt19937 random(7);
+                 return timed([&] {
+                     for (int i = 0; i < RECOMPUTED_UPDATES; ++i)
+                     {
+                         const Edge &edge = w.edges[random() % w.edges.size()];
+                         copy.removeEdge(edge.u, edge.v);
+                         sink += connected_component_amount(copy);
+                         copy.addEdge(edge.u, edge.v, edge.weight);
+                     }
+                 });
+             }},
+            {"is_k_edge_connected", InputKind::Random, 1 << 20, 1, [](Workload &w) { return timed([&] { sink += is_k_edge_connected(w.graph, 2); }); }},
+            {"is_k_vertex_connected", InputKind::Random, 1 << 16, 1, [](Workload &w) { return timed([&] { sink += is_k_vertex_connected(w.graph, 2); }); }},
+            {"graph_construction", InputKind::Random, ANY, 1, [](Workload &w) {
+                 return timed([&] {
+                     Graph graph(w.vertices, true);
+                     graph.addEdges(w.edges);
+                     sink += graph.getSize();
+                 });
+             }},
+            {"graph_copy", InputKind::Random, ANY, 1, [](Workload &w) {
+                 return timed([&] {
+                     Graph copy(w.graph);
+                     sink += copy.getSize();
+                 });
+             }},
+            {"graph_copy_remove_edge", InputKind::Random, ANY, 1, [](Workload &w) {
+                 // "O grafo menos uma aresta": so as listas das pontas sao duplicadas
+                 const Edge &edge = w.edges[w.edges.size() / 2];
+                 return timed([&] {
+                     Graph copy(w.graph);
+                     sink += copy.removeEdge(edge.u, edge.v) + copy.getSize();
+                 });
+             }},
+            {"graph_remove_vertex", InputKind::Random, 1 << 18, REMOVED_VERTICES, [=](Workload &w) {
+                 Graph copy(w.graph);
+                 return timed([&] {
+                     // Vertices consecutivos do meio: os ids nao mudam, cada remocao e de um vertice vivo
+                     for (int i = 0; i < REMOVED_VERTICES; ++i)
+                         sink += copy.removeVertex(copy.getOrder() / 2 + i);
+                 });
+             }},
+            {"graph_bulk_remove_compact", InputKind::Random, ANY, BULK_REMOVED_VERTICES, [=](Workload &w) {
+                 Graph copy(w.graph);
+                 return timed([&] {
+                     // Remocoes espalhadas pelo grafo e uma renumeracao so no fim
+                     int stride = copy.getOrder() / BULK_REMOVED_VERTICES;
+                     for (int i = 0; i < BULK_REMOVED_VERTICES; ++i)
+                         sink += copy.removeVertex(1 + i * stride);
+                     sink += copy.compact().size();
+                 });
+             }},
+        };
+    }
+
+    /**
+     * @brief Reset the peak resident set size of the process (Linux), so each size gets its own peak
+     * @return false if the kernel does not allow it; the peak is then the one of the whole run
+     */
+    bool reset_peak_rss()
+    {
+        ofstream clearRefs("/proc/self/clear_refs");
+        if (!clearRefs)
+            return false;
+        clearRefs << "5";
+        clearRefs.flush();
+        return static_cast<bool>(clearRefs);
+    }
+
+    /**
+     * @brief Peak resident set size in KiB (VmHWM, or getrusage when /proc is not available)
+     */
+    long peak_rss_kb()
+    {
+        ifstream status("/proc/self/status");
+        string line;
+        while (getline(status, line))
+        {
+            if (line.compare(0, 6, "VmHWM:") == 0)
+                return atol(line.c_str() + 6);
+        }
+        struct rusage usage;
+        getrusage(RUSAGE_SELF, &usage);
+        return usage.ru_maxrss;
+    }
+
+    bool parse_option(const string &argument, const char *name, string &value)
+    {
+        size_t length = strlen(name);
+        if (argument.compare(0, length, name) != 0 || argument.size() <= length || argument[length] != '=')
+            return false;
+        value = argument.substr(length + 1);
+        return true;
+    }
+} // namespace
+
+/**
+ * @brief Runs every benchmark over a sweep of synthetic sizes and prints the results as JSON
+ *
+ * Sizes go from 2^10 edges up to --max-edges (default 2^20) in steps of 4, skipping the sizes
+ * above the limit of each benchmark. Every size is repeated --repetitions times on the same
+ * seeded input; the JSON reports the median and the minimum time, ns per edge (median time
+ * divided by edges and operations), the allocations of one repetition and the peak RSS.
+ */
+int main(int argc, char const *argv[])
+{
+    uint64_t maxEdges = 1 << 20;
+    int repetitions = 5;
+    uint32_t seed = 12345;
+    string filter, outputPath;
+    for (int i = 1; i < argc; ++i)
+    {
+        string argument = argv[i], value;
+        if (parse_option(argument, "--max-edges", value))
+            maxEdges = strtoull(value.c_str(), nullptr, 10);
+        else if (parse_option(argument, "--repetitions", value))
+            repetitions = max(1, atoi(value.c_str()));
+        else if (parse_option(argument, "--seed", value))
+            seed = static_cast<uint32_t>(strtoul(value.c_str(), nullptr, 10));
+        else if (parse_option(argument, "--filter", value))
+            filter = value;
+        else if (parse_option(argument, "--threads", value))
+            set_thread_count(atoi(value.c_str()));
+        else if (parse_option(argument, "--output", value))
+            outputPath = value;
+        else
+        {
+            cerr << "Usage: " << argv[0] << " [--max-edges=N] [--repetitions=R] [--seed=S] [--filter=substring]"
+                 << " [--threads=N] [--output=file.json]" << endl;
+            return 1;
+        }
+    }
+
+    ofstream file;
+    if (!outputPath.empty())
+    {
+        file.open(outputPath);
+        if (!file)
+        {
+            cerr << "Error: could not open " << outputPath << endl;
+            return 1;
+        }
+    }
+    ostream &out = outputPath.empty() ? cout : file;
+
+    bool peakIsPerSize = reset_peak_rss();
+    out << "{\n  \"seed\": " << seed << ",\n  \"threads\": " << get_thread_count()
+        << ",\n  \"repetitions\": " << repetitions << ",\n  \"peak_rss_per_size\": " << (peakIsPerSize ? "true" : "false")
+        << ",\n  \"benchmarks\": [";
+    bool first = true;
+    for (Benchmark &benchmark : benchmarks())
+    {
+        if (!filter.empty() && benchmark.name.find(filter) == string::npos)
+            continue;
+        for (uint64_t edges = 1 << 10; edges <= min(maxEdges, benchmark.maxEdges); edges *= 4)
+        {
+            Workload workload = make_workload(benchmark.kind, edges, seed);
+            reset_peak_rss();
+            vector<Sample> samples;
+            for (int r = 0; r < repetitions; ++r)
+            {
+                // Cada repeticao mede o calculo, nao os resultados memoizados da anterior
+                workload.graph.discardDerived();
+                samples.push_back(benchmark.run(workload));
+            }
+            long peak = peak_rss_kb();
+
+            vector<double> times;
+            for (const Sample &sample : samples)
+                times.push_back(sample.seconds);
+            sort(times.begin(), times.end());
+            double median = times[times.size() / 2];
+            double perEdge = median * 1e9 / (static_cast<double>(edges) * benchmark.operations);
+
+            char line[512];
+            snprintf(line, sizeof(line),
+                     "%s\n    {\"name\": \"%s\", \"vertices\": %d, \"edges\": %llu, \"operations\": %d, "
+                     "\"median_seconds\": %.9f, \"min_seconds\": %.9f, \"ns_per_edge\": %.3f, "
+                     "\"peak_rss_kb\": %ld, \"allocations\": %llu, \"allocated_bytes\": %llu}",
+                     first ? "" : ",", benchmark.name.c_str(), workload.vertices,
+                     static_cast<unsigned long long>(edges), benchmark.operations, median, times.front(), perEdge,
+                     peak, static_cast<unsigned long long>(samples.front().allocations),
+                     static_cast<unsigned long long>(samples.front().bytes));
+            out << line << flush;
+            first = false;
+            cerr << benchmark.name << " m=" << edges << ": " << perEdge << " ns/aresta" << endl;
+        }
+    }
+    out << "\n  ]\n}\n";
+    return 0;
+}
@@ -0,0 +1,194 @@
+#ifndef CSR_GRAPH_HPP
+#define CSR_GRAPH_HPP
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+#include "myDS.hpp"
+
+class Graph;
+
+/**
+ * @brief Immutable compressed sparse row (CSR) snapshot of an undirected graph
+ *
+ * The half-edges leaving vertex u occupy the slots [edgeBegin(u), edgeEnd(u)) of three
+ * parallel arrays: the neighbour (target), the edge weight and the id of the undirected
+ * edge the slot belongs to. Both halves of an edge share the same id (0 .. m-1), which
+ * lets algorithms tell parallel edges apart. Vertices are 1-indexed, like in Graph.
+ *
+ * A directed snapshot (see arcs()) stores every arc only in the list of its source, with the
+ * arc index as its id. Only algorithms documented to accept arcs (e.g. Dijkstra) use them.
+ *
+ * Copies are cheap: they share the same read-only arrays.
+ */
+class CsrGraph
+{
+public:
+    /**
+     * @brief Range over the neighbours of a vertex, usable in range-based for loops
+     */
+    struct NeighborRange
+    {
+        const int *first;
+        const int *last;
+
+        const int *begin() const { return first; }
+        const int *end() const { return last; }
+    };
+
+    /**
+     * @brief Build an empty snapshot (no vertices, no edges)
+     */
+    CsrGraph();
+
+    /**
+     * @brief Build a snapshot of a graph, keeping the order of its adjacency lists
+     * @param graph The graph to pack
+     */
+    explicit CsrGraph(const Graph &graph);
+
+    /**
+     * @brief Wrap arrays owned by someone else (e.g. a memory-mapped file) without copying them
+     * @param vertices Number of vertices
+     * @param edges Number of edges
+     * @param minimumDegree Minimum degree of any vertex
+     * @param maximumDegree Maximum degree of any vertex
+     * @param offsets vertices + 2 slot offsets
+     * @param targets 2 * edges neighbours
+     * @param weights 2 * edges weights, or nullptr for an unweighted graph
+     * @param edgeIds 2 * edges edge ids
+     * @param owner Keeps the arrays alive while any copy of the snapshot exists
+     */
+    CsrGraph(int vertices, int edges, int minimumDegree, int maximumDegree,
+             const std::uint64_t *offsets, const int *targets, const int *weights, const int *edgeIds,
+             std::shared_ptr<const void> owner);
+
+    /**
+     * @brief Build a directed snapshot from a list of arcs
+     * The arcs leaving each vertex keep their input order; arc i gets the id i.
+     * @param vertices Number of vertices
+     * @param arcs Arcs (u, v, weight), with 1 <= u, v <= vertices
+     * @param weighted Whether to keep the weights (1 otherwise)
+     * @return The snapshot, whose size is the number of arcs
+     */
+    static CsrGraph arcs(int vertices, const std::vector<MyDataStructures::Edge> &arcs, bool weighted);
+
+    /**
+     * @brief Build an undirected snapshot straight from an edge list, without a Graph
+     * Neighbours come in the order Graph::addEdges would leave them (latest edge first), so
+     * algorithms give the same results as on Graph(vertices).addEdges(edges).freeze().
+     * Edges with an endpoint outside 1..vertices are skipped with the same message as addEdges.
+     * @param vertices Number of vertices
+     * @param edges Edges (u, v, weight)
+     * @param weighted Whether to keep the weights (1 otherwise)
+     * @return The snapshot; edge ids follow the order of the valid edges
+     */
+    static CsrGraph undirected(int vertices, const std::vector<MyDataStructures::Edge> &edges, bool weighted);
+
+    /**
+     * @brief Check if the snapshot stores arcs instead of undirected edges
+     */
+    bool isDirected() const { return directed; }
+
+    /**
+     * @brief Get the order of the graph (number of vertices)
+     * @return Number of vertices
+     */
+    int getOrder() const { return numVertices; }
+
+    /**
+     * @brief Get the size of the graph (number of edges)
+     * @return Number of edges
+     */
+    int getSize() const { return numEdges; }
+
+    /**
+     * @brief Check if the graph is weighted
+     * @return true if graph is weighted, false otherwise
+     */
+    bool getIsWeighted() const { return weights != nullptr; }
+
+    /**
+     * @brief Get the maximum degree of any vertex in the graph
+     * @return Maximum degree
+     */
+    int getMaxDegree() const { return maxDegree; }
+
+    /**
+     * @brief Get the minimum degree of any vertex in the graph
+     * @return Minimum degree
+     */
+    int getMinDegree() const { return minDegree; }
+
+    /**
+     * @brief Get the degree (out-degree for directed snapshots) of a specific vertex
+     * @param vertex The vertex to get the degree for
+     * @return Degree of the vertex
+     */
+    int getVertexDegree(int vertex) const { return static_cast<int>(offsets[vertex + 1] - offsets[vertex]); }
+
+    /**
+     * @brief First half-edge slot of a vertex
+     */
+    std::uint64_t edgeBegin(int vertex) const { return offsets[vertex]; }
+
+    /**
+     * @brief One past the last half-edge slot of a vertex
+     */
+    std::uint64_t edgeEnd(int vertex) const { return offsets[vertex + 1]; }
+
+    /**
+     * @brief Neighbour reached through a half-edge slot
+     */
+    int target(std::uint64_t slot) const { return targets[slot]; }
+
+    /**
+     * @brief Weight of the edge stored in a half-edge slot (1 for unweighted graphs)
+     */
+    int weight(std::uint64_t slot) const { return weights ? weights[slot] : 1; }
+
+    /**
+     * @brief Id of the undirected edge stored in a half-edge slot
+     */
+    int edgeId(std::uint64_t slot) const { return edgeIds[slot]; }
+
+    /**
+     * @brief Get the neighbours of a vertex
+     * @param vertex The vertex to get the neighbours for
+     * @return Contiguous range of neighbour ids
+     */
+    NeighborRange neighbors(int vertex) const
+    {
+        return NeighborRange{targets + offsets[vertex], targets + offsets[vertex + 1]};
+    }
+
+    /**
+     * @brief Raw arrays, for writers that dump the snapshot as is
+     */
+    const std::uint64_t *offsetsData() const { return offsets; }
+    const int *targetsData() const { return targets; }
+    const int *weightsData() const { return weights; }
+    const int *edgeIdsData() const { return edgeIds; }
+
+private:
+    struct Storage
+    {
+        std::vector<std::uint64_t> offsets;
+        std::vector<int> targets;
+        std::vector<int> weights;
+        std::vector<int> edgeIds;
+    };
+
+    int numVertices;
+    int numEdges;
+    int maxDegree;
+    int minDegree;
+    bool directed;
+    const std::uint64_t *offsets; // numVertices + 2 entries, offsets[0] == offsets[1] == 0
+    const int *targets;           // 2 * numEdges entries (numEdges if directed)
+    const int *weights;           // Same length as targets, nullptr for unweighted graphs
+    const int *edgeIds;           // Same length as targets
+    std::shared_ptr<const void> storage;    // Owner of the arrays above
+};
+
+#endif // CSR_GRAPH_HPP
@@ -0,0 +1,208 @@
+#ifndef DYNAMIC_CONNECTIVITY_HPP
+#define DYNAMIC_CONNECTIVITY_HPP
+
+#include <cstdint>
+#include <memory>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+class Graph;
+
+namespace MyDataStructures
+{
+
+    /**
+     * @brief Forest of Euler tours, each one kept in a treap ordered by position in the tour
+     *
+     * A tree is stored as the cyclic sequence of its vertices (one node per vertex) and of both
+     * arcs of every edge. Linking, cutting and rerooting are splits and merges of those
+     * sequences, so each costs O(log n) expected; the root of a treap identifies its tree.
+     * Every vertex node carries flags (e.g. "has edges of some kind") whose OR is kept for each
+     * subtree, so a flagged vertex of a tree is found in O(log n) too.
+     * Vertex nodes are created on first use: a vertex without one is a tree by itself.
+     */
+    class EulerTourForest
+    {
+    public:
+        /**
+         * @brief Build a forest of isolated vertices 1..vertices
+         */
+        explicit EulerTourForest(int vertices);
+
+        /**
+         * @brief Add an isolated vertex, numbered getOrder() + 1
+         */
+        void addVertex();
+
+        int getOrder() const { return static_cast<int>(vertexNode.size()) - 1; }
+
+        /**
+         * @brief Check if u and v are in the same tree
+         */
+        bool connected(int u, int v) const;
+
+        /**
+         * @brief Number of vertices in the tree of v
+         */
+        int treeSize(int v) const;
+
+        /**
+         * @brief Join the trees of u and v with an edge (they must be different trees)
+         * @param edge Id of the edge, used by cut
+         */
+        void link(int u, int v, int edge);
+
+        /**
+         * @brief Remove an edge added by link, splitting its tree in two
+         * @param edge Id given to link
+         */
+        void cut(int edge);
+
+        /**
+         * @brief Set or clear flag bits of a vertex
+         * @param v The vertex
+         * @param flags Bits to change
+         * @param on Set (true) or clear (false) them
+         */
+        void setFlags(int v, unsigned flags, bool on);
+
+        /**
+         * @brief Find a vertex with a flag in the tree of v
+         * @return The vertex, or 0 if no vertex of the tree has it
+         */
+        int findFlagged(int v, unsigned flag) const;
+
+    private:
+        struct TourNode
+        {
+            int left, right, parent;
+            std::uint32_t priority;
+            int size;           // Nodes in the subtree
+            int vertices;       // Vertex nodes in the subtree
+            int vertex;         // Vertex of a vertex node, 0 for an arc
+            unsigned own;       // Flags of this vertex
+            unsigned any;       // OR of the flags in the subtree
+        };
+
+        std::vector<TourNode> nodes;
+        std::vector<int> freeNodes;
+        std::vector<int> vertexNode;                           // -1 ate o primeiro uso
+        std::unordered_map<int, std::pair<int, int>> arcs;     // edge -> (arco u->v, arco v->u)
+        std::uint32_t seed;
+
+        int newNode(int vertex);
+        int ensureVertex(int v);
+        void update(int x);
+        int root(int x) const;
+        int position(int x) const;
+        void split(int t, int k, int &first, int &rest);
+        int merge(int a, int b);
+        int reroot(int x);
+    };
+
+    /**
+     * @brief Connectivity of a graph under edge insertions and deletions
+     *
+     * Holm, de Lichtenberg and Thorup: a spanning forest is kept in Euler tour trees and every
+     * edge has a level, at most log2 n. Inserting an edge or removing a non-tree edge costs
+     * O(log n); removing a tree edge searches the smaller of the two halves for a replacement,
+     * level by level, raising the levels of the edges it looks at so that each edge is scanned
+     * O(log n) times over its lifetime: O(log² n) amortized per update. connected() and the
+     * component count and sizes are answered from the forest in O(log n) or O(1).
+     *
+     * Parallel edges and self-loops are allowed, and removeEdge removes one copy, like Graph.
+     * Vertices are 1-indexed. Not thread-safe.
+     */
+    class DynamicConnectivity
+    {
+    public:
+        /**
+         * @brief Build a graph with the given isolated vertices
+         */
+        explicit DynamicConnectivity(int vertices = 0);
+
+        /**
+         * @brief Build the structure for the current edges of a graph
+         * Later changes to the graph must be repeated here (addEdge, removeEdge, addVertex).
+         * Removed vertices of the graph (see Graph::removeVertex) are not counted as components.
+         */
+        explicit DynamicConnectivity(const Graph &graph);
+
+        /**
+         * @brief Add an isolated vertex
+         * @return The index of the new vertex
+         */
+        int addVertex();
+
+        /**
+         * @brief Add an edge, in O(log n)
+         */
+        void addEdge(int u, int v);
+
+        /**
+         * @brief Remove one edge between u and v, in O(log² n) amortized
+         * @return false if there is no such edge
+         */
+        bool removeEdge(int u, int v);
+
+        /**
+         * @brief Check if there is a path between u and v, in O(log n)
+         */
+        bool connected(int u, int v) const;
+
+        /**
+         * @brief Number of connected components, in O(1)
+         */
+        int componentCount() const { return components; }
+
+        /**
+         * @brief Number of vertices in the component of v, in O(log n)
+         */
+        int componentSize(int v) const;
+
+        int getOrder() const { return numVertices; }
+        int getSize() const { return numEdges; }
+
+    private:
+        static const unsigned TREE_EDGES = 1;     // Vertex has tree edges of the level
+        static const unsigned NON_TREE_EDGES = 2; // Vertex has non-tree edges of the level
+
+        struct EdgeRecord
+        {
+            int u, v;
+            int level;
+            bool tree;
+            int position[2]; // Indices in the lists of u and v at its level
+        };
+
+        /**
+         * @brief One level i: the forest of the tree edges of level >= i and the edges of level i
+         */
+        struct Level
+        {
+            EulerTourForest forest;
+            std::vector<std::vector<int>> treeEdges;    // treeEdges[v] = tree edges of level i at v
+            std::vector<std::vector<int>> nonTreeEdges; // nonTreeEdges[v] = non-tree edges of level i at v
+
+            explicit Level(int vertices) : forest(vertices), treeEdges(vertices + 1), nonTreeEdges(vertices + 1) {}
+        };
+
+        int numVertices;
+        int numEdges;
+        int components;
+        std::vector<EdgeRecord> edges;
+        std::vector<int> freeEdges;
+        std::vector<std::unique_ptr<Level>> levels;                  // Criados quando usados
+        std::unordered_map<std::uint64_t, std::vector<int>> between; // Par de vertices -> arestas
+
+        Level &level(int i);
+        void attach(int edge);
+        void detach(int edge);
+        void replace(int u, int v, int topLevel);
+        static std::uint64_t key(int u, int v);
+    };
+
+} // namespace MyDataStructures
+
+#endif // DYNAMIC_CONNECTIVITY_HPP
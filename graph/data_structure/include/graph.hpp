@@ -5,47 +5,138 @@
 #include <vector>
 #include <memory>
 #include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <mutex>
 #include "myDS.hpp"
+#include "csr_graph.hpp"
+#include "node_allocator.hpp"
 
 using namespace MyDataStructures;
+
+/**
+ * @brief Results derived from a graph that Graph::memoize keeps until the graph changes
+ * Each property is always stored with the same type, given next to it.
+ */
+enum class DerivedProperty
+{
+    Snapshot,           // CsrGraph (freeze)
+    ComponentLabels,    // ComponentLabels (component_labels)
+    EulerianProperties, // EulerianTrailProperties: degree parity and connectivity
+    Bridges,            // Biconnectivity (find_bridges)
+    MinimumSpanningTree // std::vector<Edge> (kruskal_mst)
+};
+
+const int DERIVED_PROPERTY_COUNT = 5;
+
 /**
  * @brief Graph class using adjacency list representation
+ *
+ * Copies share the adjacency lists with the original: a list is duplicated, by whichever of
+ * the graphs changes it first, only when an edge is removed from it (addEdge just puts a new
+ * node in front of the shared nodes). Shared nodes are never modified.
  */
 class Graph {
 private:
-    std::vector<std::shared_ptr<Node>> adjacencyList;
-    int numVertices;    // Order of the graph
+    std::vector<Node *> adjacencyList;
+    std::shared_ptr<NodeAllocator> allocator;             // Allocates the new nodes of this graph
+    std::vector<std::shared_ptr<NodeAllocator>> borrowed; // Allocators of the nodes shared with other graphs
+    mutable std::atomic<std::uint64_t> owner;             // Replaced when a copy starts sharing the lists
+    std::vector<std::uint64_t> listOwner;                 // listOwner[v] == owner: list v is not shared
+    int numVertices;    // Order of the graph (vertex ids 1..numVertices, removed ones included)
+    int liveVertices;   // Vertices not removed
     int numEdges;       // Size of the graph
     int maxDegree;      // Maximum degree of any vertex
     int minDegree;      // Minimum degree of any vertex
     bool isWeighted;    // Flag to indicate if the graph is weighted
 
+    std::vector<int> degree;       // degree[v] = degree of vertex v
+    std::vector<int> degreeCount;  // degreeCount[d] = amount of live vertices with degree d
+    std::vector<bool> live;        // live[v] = v was not removed (bitmap)
+
+    /**
+     * @brief Memoized results of the current version (a copy starts with the same ones)
+     */
+    struct DerivedCache
+    {
+        std::mutex lock;
+        std::shared_ptr<const void> value[DERIVED_PROPERTY_COUNT];
+        bool populated = false;
+    };
+
+    std::uint64_t version;                  // Unique across graphs, new on every change
+    std::unique_ptr<DerivedCache> derived;  // Never null
+
+    /**
+     * @brief Start a new version: drop every memoized result
+     */
+    void changed();
+
+    /**
+     * @brief Increase the degree of a vertex by one, keeping min/max degree in O(1)
+     * @param vertex The vertex that gained a half-edge
+     */
+    void incrementDegree(int vertex);
+
+    /**
+     * @brief Decrease the degree of a vertex by one, keeping min/max degree in O(1)
+     * @param vertex The vertex that lost a half-edge
+     */
+    void decrementDegree(int vertex);
+
     /**
-     * @brief Calculate the degree of a vertex
-     * @param vertex The vertex to calculate degree for
-     * @return The degree of the vertex
+     * @brief Rebuild the degree histogram and min/max degree from the degree array
      */
-    int calculateDegree(int vertex) const;
+    void rebuildDegreeHistogram();
 
     /**
-     * @brief Update max and min degrees after adding an edge
+     * @brief Make the list of a vertex only ours, duplicating it if it is shared, in O(d(v))
+     * @param vertex The vertex whose list is about to be changed in place
      */
-    void updateDegrees();
+    void ownList(int vertex);
 
 public:
     /**
      * @brief Constructor for the Graph class
      * @param vertices Number of vertices in the graph
      * @param weighted Whether the graph is weighted
+     * @param nodeAllocator Allocator for the adjacency nodes (default is an arena owned by the graph)
      */
-    Graph(int vertices = 0, bool weighted = false);
+    Graph(int vertices = 0, bool weighted = false, std::unique_ptr<NodeAllocator> nodeAllocator = nullptr);
 
     /**
-     * @brief Copy constructor for the Graph class
+     * @brief Copy constructor for the Graph class, in O(n): the adjacency lists are shared
+     * The copy gets a new, empty allocator of the same kind as the original for the nodes it adds;
+     * the nodes both graphs share are freed with the last of them. Changing one of the graphs
+     * later duplicates only the lists it touches, so "the graph minus one edge" costs O(d(u) + d(v)).
+     * An allocator that does not release in bulk (HeapNodeAllocator) gets a deep copy instead.
      * @param other The graph to copy
      */
     Graph(const Graph &other);
 
+    /**
+     * @brief Build a graph from a CSR snapshot, keeping the order of its neighbours
+     * @param snapshot The snapshot to unpack (undirected)
+     */
+    explicit Graph(const CsrGraph &snapshot);
+
+    /**
+     * @brief Move constructor for the Graph class
+     * @param other The graph to move from (left empty)
+     */
+    Graph(Graph &&other) noexcept;
+
+    /**
+     * @brief Assignment operator (copy or move, through the parameter)
+     * @param other The graph to assign from
+     */
+    Graph &operator=(Graph other) noexcept;
+
+    /**
+     * @brief Destructor, gives every node back to the allocator
+     */
+    ~Graph();
+
     /**
      * @brief Add a new isolated vertex to the graph
      * @return The index of the new vertex
@@ -60,12 +151,33 @@ public:
      */
     void addEdge(int u, int v, int weight = 1);
 
+    /**
+     * @brief Add many edges at once, updating the degree bookkeeping a single time
+     * @param edges The edges to add (weights are ignored if the graph is not weighted)
+     */
+    void addEdges(const std::vector<Edge> &edges);
+
     /**
      * @brief Get the order of the graph (number of vertices)
+     * Removed vertices keep their ids until compact(), so this is the largest vertex id:
+     * algorithms see a removed vertex as isolated. See getLiveVertexCount.
      * @return Number of vertices
      */
     int getOrder() const;
 
+    /**
+     * @brief Get the number of vertices that were not removed
+     * @return Number of live vertices (getOrder() after compact())
+     */
+    int getLiveVertexCount() const;
+
+    /**
+     * @brief Check if a vertex id is in range and was not removed
+     * @param vertex The vertex to check
+     * @return true if the vertex exists
+     */
+    bool isVertexLive(int vertex) const;
+
     /**
      * @brief Get the size of the graph (number of edges)
      * @return Number of edges
@@ -79,7 +191,7 @@ public:
     int getMaxDegree() const;
 
     /**
-     * @brief Get the minimum degree of any vertex in the graph
+     * @brief Get the minimum degree of any vertex in the graph (removed vertices do not count)
      * @return Minimum degree
      */
     int getMinDegree() const;
@@ -96,7 +208,13 @@ public:
      * @param vertex The vertex to get the adjacency list for
      * @return Pointer to the first node in the adjacency list
      */
-    std::shared_ptr<Node> getAdjacencyList(int vertex) const;
+    const Node *getAdjacencyList(int vertex) const;
+
+    /**
+     * @brief Get the counters of the node allocator
+     * @return Allocation statistics since the graph was created
+     */
+    const AllocationStats &getAllocationStats() const;
 
     /**
      * @brief Remove an edge between two vertices
@@ -107,11 +225,20 @@ public:
     bool removeEdge(int u, int v);
 
     /**
-     * @brief Remove a vertex and all its incident edges
+     * @brief Remove a vertex and all its incident edges, leaving a tombstone
+     * The ids of the other vertices do not change: the removed id stays unused (edge-less and
+     * rejected by addEdge) until compact(). Costs O(d(v) + sum of the degrees of its neighbours).
      * @param vertex The vertex to remove
-     * @return true if vertex was removed, false if vertex didn't exist
+     * @return true if vertex was removed, false if vertex didn't exist or was already removed
      */
     bool removeVertex(int vertex);
+
+    /**
+     * @brief Renumber the live vertices 1..getLiveVertexCount(), keeping their order, in one pass
+     * Run it after a batch of removeVertex, before algorithms that should not see the removed ids.
+     * @return mapping[old id] = new id, or 0 for a removed vertex (size: old getOrder() + 1)
+     */
+    std::vector<int> compact();
     
     /**
      * @brief Check if the graph is weighted
@@ -125,6 +252,55 @@ public:
      */
     void setIsWeighted(bool weighted);
 
+    /**
+     * @brief Pack the graph into an immutable CSR snapshot for read-only algorithms
+     * The snapshot is built once per version and shared by later calls (copies are cheap).
+     * @return Snapshot with contiguous offsets, targets and weights
+     */
+    CsrGraph freeze() const;
+
+    /**
+     * @brief Version of the graph: changes on every addVertex, addEdge(s), removeEdge,
+     * removeVertex, compact and setIsWeighted that modifies it
+     * Versions are never reused, also across graphs, so two graphs with the same version
+     * (a graph and its copy) have the same vertices and edges.
+     * @return The current version
+     */
+    std::uint64_t getVersion() const;
+
+    /**
+     * @brief Drop the memoized results without changing the graph (the version stays the same)
+     * For benchmarks, so that every repetition measures the computation and not the cache.
+     */
+    void discardDerived();
+
+    /**
+     * @brief Get a result derived from the graph, computing it only once per version
+     * Safe to call from several threads at once (they may compute it concurrently, the first
+     * stored result wins), but not while the graph is being modified.
+     * @param property Which result; always used with the same T (see DerivedProperty)
+     * @param compute Computes the result from the current graph, returns a T
+     * @return The result, valid even after the graph changes
+     */
+    template <typename T, typename Compute>
+    std::shared_ptr<const T> memoize(DerivedProperty property, Compute compute) const
+    {
+        int slot = static_cast<int>(property);
+        {
+            std::lock_guard<std::mutex> guard(derived->lock);
+            if (derived->value[slot])
+                return std::static_pointer_cast<const T>(derived->value[slot]);
+        }
+        // Calcula fora da trava: compute pode memoizar outras propriedades (ex.: o snapshot)
+        std::shared_ptr<const T> result = std::make_shared<const T>(compute());
+        std::lock_guard<std::mutex> guard(derived->lock);
+        if (derived->value[slot])
+            return std::static_pointer_cast<const T>(derived->value[slot]);
+        derived->value[slot] = result;
+        derived->populated = true;
+        return result;
+    }
+
     /**
      * @brief Print the graph structure and properties
      */
@@ -0,0 +1,90 @@
+#ifndef INDEXED_HEAP_HPP
+#define INDEXED_HEAP_HPP
+
+#include <cstdint>
+#include <vector>
+
+namespace MyDataStructures
+{
+
+    /**
+     * @brief Indexed 4-ary min-heap over the items 0 .. capacity-1, with decrease-key
+     *
+     * Each item is in the heap at most once and its position is tracked, so the heap never
+     * holds more than capacity entries (e.g. n vertices, however many edges are relaxed).
+     * A 4-ary layout keeps the tree shallow and the children of a node in one cache line.
+     */
+    class IndexedHeap
+    {
+    public:
+        static const int ARITY = 4;
+
+        /**
+         * @brief Create an empty heap
+         * @param capacity Number of items (items are 0 .. capacity-1)
+         */
+        explicit IndexedHeap(int capacity = 0);
+
+        bool empty() const { return heap.empty(); }
+        int size() const { return static_cast<int>(heap.size()); }
+
+        /**
+         * @brief Check if an item is currently in the heap
+         */
+        bool contains(int item) const { return position[item] != ABSENT; }
+
+        /**
+         * @brief Key of an item in the heap
+         */
+        std::int64_t keyOf(int item) const { return key[item]; }
+
+        /**
+         * @brief Item with the smallest key
+         */
+        int top() const { return heap[0]; }
+
+        /**
+         * @brief Smallest key
+         */
+        std::int64_t topKey() const { return key[heap[0]]; }
+
+        /**
+         * @brief Insert an item that is not in the heap
+         */
+        void push(int item, std::int64_t itemKey);
+
+        /**
+         * @brief Lower the key of an item in the heap (larger keys are ignored)
+         */
+        void decreaseKey(int item, std::int64_t itemKey);
+
+        /**
+         * @brief Insert an item, or lower its key if it is already in the heap
+         * @return true if the heap changed
+         */
+        bool pushOrDecrease(int item, std::int64_t itemKey);
+
+        /**
+         * @brief Remove and return the item with the smallest key
+         */
+        int pop();
+
+        /**
+         * @brief Remove every item, keeping the capacity
+         */
+        void clear();
+
+    private:
+        static const int ABSENT = -1;
+
+        void siftUp(int index);
+        void siftDown(int index);
+
+        std::vector<int> heap;          // Items in heap order
+        std::vector<int> position;      // Index of each item in heap, or ABSENT
+        std::vector<std::int64_t> key;  // Key of each item (valid while it is in the heap)
+    };
+
+} // namespace MyDataStructures
+
+#endif // INDEXED_HEAP_HPP
@@ -6,6 +6,8 @@
 #include <stack>
 #include <iostream>
 #include <memory>
+#include <atomic>
+#include "metrics.hpp"
 using namespace std;
 
 namespace MyDataStructures
@@ -18,7 +20,7 @@ namespace MyDataStructures
     {
         int vertex;                 // The vertex that makes an edge with the vertex of its list index
         int weight;                 // Weight of the edge (default is 1 for unweighted graphs)
-        std::shared_ptr<Node> next; // Pointer to the next node in the list
+        Node *next;                 // Pointer to the next node in the list (owned by the graph's NodeAllocator)
 
         Node(int v, int w = 1) : vertex(v), weight(w), next(nullptr) {}
     };
@@ -32,6 +34,7 @@ namespace MyDataStructures
         int v;      // Second vertex
         int weight; // Weight of the edge
 
+        Edge() : u(0), v(0), weight(0) {}
         Edge(int u, int v, int weight) : u(u), v(v), weight(weight) {}
     };
 
@@ -50,28 +53,95 @@ namespace MyDataStructures
         EulerianTrailProperties() : isEulerian(false), hasTFE(false), hasTAE(false), startTAE(-1), endTAE(-1) {}
     };
 
-    // Union-Find (Disjoint Set Union)
+    /**
+     * @brief Structure to represent a minimum edge cut of a graph
+     */
+    struct EdgeCut
+    {
+        int size;            // Number of edges in the cut (the edge connectivity)
+        vector<Edge> edges;  // Edges whose removal disconnects the graph
+        vector<int> side;    // Vertices on one side of the cut
+
+        EdgeCut() : size(0) {}
+    };
+
+    /**
+     * @brief Structure to represent a minimum vertex separator of a graph
+     */
+    struct VertexCut
+    {
+        int size;               // Number of vertices in the separator (the vertex connectivity)
+        vector<int> separator;  // Vertices whose removal disconnects the graph
+        vector<int> side;       // Vertices of one component left after removing the separator
+
+        VertexCut() : size(0) {}
+    };
+
+    /**
+     * @brief Structure to represent the connected components of a graph
+     * Components are numbered 0 .. count-1 in the order of their smallest vertex.
+     */
+    struct ComponentLabels
+    {
+        int count;                         // Number of connected components
+        vector<int> label;                 // label[v] = component of vertex v (-1: index 0 and removed vertices)
+        vector<int> sizes;                 // sizes[c] = number of vertices in component c
+        vector<pair<int, int>> histogram;  // (size, number of components of that size), by increasing size
+
+        ComponentLabels() : count(0) {}
+
+        bool connected() const { return count <= 1; }
+        bool same_component(int u, int v) const { return label[u] == label[v]; }
+        // Vertices fora de 1..n e vertices removidos nao pertencem a nenhuma componente
+        int component_size(int v) const
+        {
+            return v >= 1 && v < static_cast<int>(label.size()) && label[v] >= 0 ? sizes[label[v]] : 0;
+        }
+    };
+
+    /**
+     * @brief Union-Find (Disjoint Set Union) over the elements 1..n, for a single thread
+     * UnionFind and ConcurrentUnionFind share the same interface, so templated code can take either:
+     * find(x) returns the root of x's set (iterative, with path splitting), unite(x, y) merges two
+     * sets and returns false if they were already one, connected(x, y) tests membership and
+     * root(x) finds the root without modifying anything.
+     */
     class UnionFind
     {
-        vector<int> parent, rank;
+        vector<int> parent;
+        vector<unsigned char> rank; // rank <= log2(n), cabe num byte
 
     public:
         UnionFind(int n) : parent(n + 1), rank(n + 1, 0)
         {
-            for (int i = 1; i <= n; ++i)
+            for (int i = 0; i <= n; ++i)
                 parent[i] = i;
         }
         int find(int x)
         {
-            if (parent[x] != x)
-                parent[x] = find(parent[x]); // Path compression
-            return parent[x];
+            GRAPH_METRICS_ADD(UnionFindFinds, 1);
+            // Divisao de caminho: cada vertice do caminho passa a apontar para o avo
+            while (parent[x] != x)
+            {
+                int next = parent[x];
+                parent[x] = parent[next];
+                x = next;
+            }
+            return x;
         }
-        void unite(int x, int y)
+        // Raiz sem compressao de caminho: so le, pode ser chamada por varias threads ao mesmo tempo
+        // enquanto nenhuma delas chama find ou unite
+        int root(int x) const
+        {
+            while (parent[x] != x)
+                x = parent[x];
+            return x;
+        }
+        bool unite(int x, int y)
         {
             int rx = find(x), ry = find(y);
             if (rx == ry)
-                return;
+                return false;
             if (rank[rx] < rank[ry])
                 parent[rx] = ry;
             else
@@ -80,6 +150,75 @@ namespace MyDataStructures
                 if (rank[rx] == rank[ry])
                     rank[rx]++;
             }
+            return true;
+        }
+        bool connected(int x, int y) { return find(x) == find(y); }
+    };
+
+    /**
+     * @brief Lock-free Union-Find (Jayanti–Tarjan) that many threads can use at once
+     * unite links the root with the larger index under the other one by CAS, and find splits
+     * paths with CAS too, so the root of every set is its smallest element.
+     */
+    class ConcurrentUnionFind
+    {
+        vector<atomic<int>> parent;
+
+    public:
+        ConcurrentUnionFind(int n) : parent(n + 1)
+        {
+            for (int i = 0; i <= n; ++i)
+                parent[i].store(i, memory_order_relaxed);
+        }
+        int find(int x)
+        {
+            GRAPH_METRICS_ADD(UnionFindFinds, 1);
+            while (true)
+            {
+                int p = parent[x].load(memory_order_relaxed);
+                int grand = parent[p].load(memory_order_relaxed);
+                if (p == grand)
+                    return p;
+                // Se outra thread mudou parent[x] antes, tanto faz: o caminho so encurta
+                parent[x].compare_exchange_weak(p, grand, memory_order_relaxed);
+                x = p;
+            }
+        }
+        int root(int x) const
+        {
+            int p;
+            while ((p = parent[x].load(memory_order_relaxed)) != x)
+                x = p;
+            return x;
+        }
+        bool unite(int x, int y)
+        {
+            while (true)
+            {
+                x = find(x);
+                y = find(y);
+                if (x == y)
+                    return false;
+                if (x < y)
+                    swap(x, y);
+                // x e a raiz maior; se deixou de ser raiz, recomeca
+                int expected = x;
+                if (parent[x].compare_exchange_strong(expected, y, memory_order_relaxed))
+                    return true;
+            }
+        }
+        bool connected(int x, int y)
+        {
+            while (true)
+            {
+                x = find(x);
+                y = find(y);
+                if (x == y)
+                    return true;
+                // x ainda e raiz: os conjuntos eram mesmo diferentes neste instante
+                if (parent[x].load(memory_order_relaxed) == x)
+                    return false;
+            }
         }
     };
 
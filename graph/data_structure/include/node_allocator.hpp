@@ -0,0 +1,100 @@
+#ifndef NODE_ALLOCATOR_HPP
+#define NODE_ALLOCATOR_HPP
+
+#include <cstddef>
+#include <memory>
+#include <vector>
+#include "myDS.hpp"
+
+namespace MyDataStructures
+{
+
+    /**
+     * @brief Counters kept by every node allocator
+     */
+    struct AllocationStats
+    {
+        std::size_t nodeAllocations = 0; // Nodes handed out to the graph
+        std::size_t nodeReleases = 0;    // Nodes given back by the graph
+        std::size_t nodesReused = 0;     // Allocations served from the free-list
+        std::size_t heapAllocations = 0; // Calls that reached the system allocator
+    };
+
+    /**
+     * @brief Interface used by Graph to obtain and give back adjacency list nodes
+     */
+    class NodeAllocator
+    {
+    public:
+        virtual ~NodeAllocator() = default;
+
+        /**
+         * @brief Get a node initialised with the given vertex and weight
+         */
+        virtual Node *allocate(int vertex, int weight) = 0;
+
+        /**
+         * @brief Give a node back to the allocator
+         */
+        virtual void release(Node *node) = 0;
+
+        /**
+         * @brief Whether destroying the allocator frees every node it handed out
+         * @return true if the graph may skip releasing its nodes one by one
+         */
+        virtual bool releasesInBulk() const = 0;
+
+        /**
+         * @brief Create a new, empty allocator of the same kind (used by Graph copies)
+         */
+        virtual std::unique_ptr<NodeAllocator> createEmpty() const = 0;
+
+        /**
+         * @brief Get the allocation counters
+         */
+        const AllocationStats &getStats() const { return stats; }
+
+    protected:
+        AllocationStats stats;
+    };
+
+    /**
+     * @brief Slab allocator owned by a single graph
+     *
+     * Nodes are carved from slabs that double in size up to a limit. Released nodes go to
+     * a free-list (threaded through Node::next) and are reused by the next allocations.
+     * Every slab is freed at once when the allocator is destroyed.
+     */
+    class ArenaNodeAllocator : public NodeAllocator
+    {
+        std::vector<std::vector<Node>> slabs;
+        Node *freeList;
+        std::size_t nextSlabSize;
+
+    public:
+        static constexpr std::size_t MIN_SLAB_SIZE = 64;
+        static constexpr std::size_t MAX_SLAB_SIZE = 1 << 16;
+
+        ArenaNodeAllocator();
+
+        Node *allocate(int vertex, int weight) override;
+        void release(Node *node) override;
+        bool releasesInBulk() const override { return true; }
+        std::unique_ptr<NodeAllocator> createEmpty() const override;
+    };
+
+    /**
+     * @brief One new/delete per node, kept to compare against the arena
+     */
+    class HeapNodeAllocator : public NodeAllocator
+    {
+    public:
+        Node *allocate(int vertex, int weight) override;
+        void release(Node *node) override;
+        bool releasesInBulk() const override { return false; }
+        std::unique_ptr<NodeAllocator> createEmpty() const override;
+    };
+
+} // namespace MyDataStructures
+
+#endif // NODE_ALLOCATOR_HPP
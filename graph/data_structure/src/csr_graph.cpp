@@ -0,0 +1,222 @@
+#include "csr_graph.hpp"
+#include "graph.hpp"
+#include <algorithm>
+
+/**
+ * @brief Build an empty snapshot (no vertices, no edges)
+ */
+CsrGraph::CsrGraph() : numVertices(0), numEdges(0), maxDegree(0), minDegree(0), directed(false), weights(nullptr)
+{
+    auto owned = std::make_shared<Storage>();
+    owned->offsets.assign(2, 0);
+    offsets = owned->offsets.data();
+    targets = owned->targets.data();
+    edgeIds = owned->edgeIds.data();
+    storage = owned;
+}
+
+/**
+ * @brief Wrap arrays owned by someone else (e.g. a memory-mapped file) without copying them
+ */
+CsrGraph::CsrGraph(int vertices, int edges, int minimumDegree, int maximumDegree,
+                   const std::uint64_t *offsets, const int *targets, const int *weights, const int *edgeIds,
+                   std::shared_ptr<const void> owner)
+    : numVertices(vertices), numEdges(edges), maxDegree(maximumDegree), minDegree(minimumDegree), directed(false),
+      offsets(offsets), targets(targets), weights(weights), edgeIds(edgeIds), storage(std::move(owner))
+{
+}
+
+/**
+ * @brief Build a snapshot of a graph, keeping the order of its adjacency lists
+ * @param graph The graph to pack
+ */
+CsrGraph::CsrGraph(const Graph &graph)
+    : numVertices(graph.getOrder()),
+      numEdges(graph.getSize()),
+      maxDegree(graph.getMaxDegree()),
+      // Ids removidos (ate o compact) entram no snapshot como vertices isolados
+      minDegree(graph.getLiveVertexCount() < graph.getOrder() ? 0 : graph.getMinDegree()),
+      directed(false)
+{
+    const int n = numVertices;
+    auto owned = std::make_shared<Storage>();
+
+    // offsets[v + 1] - offsets[v] = grau de v
+    owned->offsets.assign(n + 2, 0);
+    for (int u = 1; u <= n; ++u)
+        owned->offsets[u + 1] = owned->offsets[u] + graph.getVertexDegree(u);
+
+    const std::uint64_t halfEdges = owned->offsets[n + 1];
+    owned->targets.resize(halfEdges);
+    owned->edgeIds.resize(halfEdges);
+    if (graph.getIsWeighted())
+        owned->weights.resize(halfEdges);
+
+    // Copia as listas na ordem original e conta, para cada v, as meias-arestas (u, v) com u < v
+    std::vector<std::uint64_t> bucketStart(n + 2, 0);
+    for (int u = 1; u <= n; ++u)
+    {
+        std::uint64_t slot = owned->offsets[u];
+        for (auto current = graph.getAdjacencyList(u); current != nullptr; current = current->next, ++slot)
+        {
+            owned->targets[slot] = current->vertex;
+            if (graph.getIsWeighted())
+                owned->weights[slot] = current->weight;
+            if (u < current->vertex)
+                ++bucketStart[current->vertex + 1];
+        }
+    }
+    for (int v = 1; v <= n; ++v)
+        bucketStart[v + 1] += bucketStart[v];
+
+    // Pairs the two halves of every edge. Lower endpoints hand out ids in increasing vertex
+    // order, so the ids waiting in bucket[v] are grouped by their source vertex; cursor[u]
+    // then points at the next unused id that u sent to v.
+    std::vector<std::pair<int, int>> bucket(bucketStart[n + 1]);
+    std::vector<std::uint64_t> bucketFill(bucketStart.begin(), bucketStart.end());
+    std::vector<std::uint64_t> cursor(n + 1, 0);
+    int nextId = 0;
+    for (int u = 1; u <= n; ++u)
+    {
+        for (std::uint64_t i = bucketStart[u]; i < bucketStart[u + 1]; ++i)
+        {
+            if (i == bucketStart[u] || bucket[i - 1].first != bucket[i].first)
+                cursor[bucket[i].first] = i;
+        }
+
+        int openLoop = -1; // a self-loop appears twice in its own list
+        for (std::uint64_t slot = owned->offsets[u]; slot < owned->offsets[u + 1]; ++slot)
+        {
+            int v = owned->targets[slot];
+            if (v > u)
+            {
+                owned->edgeIds[slot] = nextId;
+                bucket[bucketFill[v]++] = {u, nextId};
+                ++nextId;
+            }
+            else if (v < u)
+            {
+                owned->edgeIds[slot] = bucket[cursor[v]++].second;
+            }
+            else if (openLoop == -1)
+            {
+                owned->edgeIds[slot] = openLoop = nextId++;
+            }
+            else
+            {
+                owned->edgeIds[slot] = openLoop;
+                openLoop = -1;
+            }
+        }
+    }
+
+    offsets = owned->offsets.data();
+    targets = owned->targets.data();
+    weights = graph.getIsWeighted() ? owned->weights.data() : nullptr;
+    edgeIds = owned->edgeIds.data();
+    storage = owned;
+}
+
+/**
+ * @brief Build a directed snapshot from a list of arcs
+ */
+CsrGraph CsrGraph::arcs(int vertices, const std::vector<MyDataStructures::Edge> &arcs, bool weighted)
+{
+    const int n = vertices;
+    auto owned = std::make_shared<Storage>();
+
+    // Counting sort estavel dos arcos pela origem
+    owned->offsets.assign(n + 2, 0);
+    for (const MyDataStructures::Edge &arc : arcs)
+        ++owned->offsets[arc.u + 1];
+    int maximumDegree = 0, minimumDegree = n > 0 ? static_cast<int>(arcs.size()) : 0;
+    for (int u = 1; u <= n; ++u)
+    {
+        int degree = static_cast<int>(owned->offsets[u + 1]);
+        maximumDegree = std::max(maximumDegree, degree);
+        minimumDegree = std::min(minimumDegree, degree);
+        owned->offsets[u + 1] += owned->offsets[u];
+    }
+
+    owned->targets.resize(arcs.size());
+    owned->edgeIds.resize(arcs.size());
+    if (weighted)
+        owned->weights.resize(arcs.size());
+    std::vector<std::uint64_t> fill(owned->offsets.begin(), owned->offsets.end() - 1);
+    for (std::size_t i = 0; i < arcs.size(); ++i)
+    {
+        std::uint64_t slot = fill[arcs[i].u]++;
+        owned->targets[slot] = arcs[i].v;
+        owned->edgeIds[slot] = static_cast<int>(i);
+        if (weighted)
+            owned->weights[slot] = arcs[i].weight;
+    }
+
+    CsrGraph snapshot(n, static_cast<int>(arcs.size()), minimumDegree, maximumDegree,
+                      owned->offsets.data(), owned->targets.data(),
+                      weighted ? owned->weights.data() : nullptr, owned->edgeIds.data(), owned);
+    snapshot.directed = true;
+    return snapshot;
+}
+
+/**
+ * @brief Build an undirected snapshot straight from an edge list, without a Graph
+ */
+CsrGraph CsrGraph::undirected(int vertices, const std::vector<MyDataStructures::Edge> &edges, bool weighted)
+{
+    const int n = vertices;
+    auto owned = std::make_shared<Storage>();
+
+    owned->offsets.assign(n + 2, 0);
+    int validEdges = 0;
+    for (const MyDataStructures::Edge &edge : edges)
+    {
+        if (edge.u < 1 || edge.v < 1 || edge.u > n || edge.v > n)
+        {
+            std::cout << "Error: Vertex out of range" << std::endl;
+            continue;
+        }
+        ++owned->offsets[edge.u + 1];
+        ++owned->offsets[edge.v + 1];
+        ++validEdges;
+    }
+    int maximumDegree = 0, minimumDegree = n > 0 ? 2 * validEdges : 0;
+    for (int u = 1; u <= n; ++u)
+    {
+        int degree = static_cast<int>(owned->offsets[u + 1]);
+        maximumDegree = std::max(maximumDegree, degree);
+        minimumDegree = std::min(minimumDegree, degree);
+        owned->offsets[u + 1] += owned->offsets[u];
+    }
+
+    const std::uint64_t halfEdges = owned->offsets[n + 1];
+    owned->targets.resize(halfEdges);
+    owned->edgeIds.resize(halfEdges);
+    if (weighted)
+        owned->weights.resize(halfEdges);
+
+    // Cada lista e preenchida do fim para o comeco: a ultima aresta lida fica na frente, como
+    // nas listas encadeadas do Graph
+    std::vector<std::uint64_t> fill(owned->offsets.begin() + 1, owned->offsets.end());
+    int id = 0;
+    for (const MyDataStructures::Edge &edge : edges)
+    {
+        if (edge.u < 1 || edge.v < 1 || edge.u > n || edge.v > n)
+            continue;
+        int weight = weighted ? edge.weight : 1;
+        std::uint64_t slot = --fill[edge.u];
+        owned->targets[slot] = edge.v;
+        owned->edgeIds[slot] = id;
+        if (weighted)
+            owned->weights[slot] = weight;
+        slot = --fill[edge.v];
+        owned->targets[slot] = edge.u;
+        owned->edgeIds[slot] = id;
+        if (weighted)
+            owned->weights[slot] = weight;
+        ++id;
+    }
+
+    return CsrGraph(n, validEdges, minimumDegree, maximumDegree, owned->offsets.data(), owned->targets.data(),
+                    weighted ? owned->weights.data() : nullptr, owned->edgeIds.data(), owned);
+}
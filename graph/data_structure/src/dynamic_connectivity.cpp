@@ -0,0 +1,450 @@
+#include "dynamic_connectivity.hpp"
+#include "graph.hpp"
+#include <iostream>
+
+namespace MyDataStructures
+{
+
+    const unsigned DynamicConnectivity::TREE_EDGES;
+    const unsigned DynamicConnectivity::NON_TREE_EDGES;
+
+    EulerTourForest::EulerTourForest(int vertices) : vertexNode(vertices + 1, -1), seed(2463534242u)
+    {
+    }
+
+    void EulerTourForest::addVertex()
+    {
+        vertexNode.push_back(-1);
+    }
+
+    int EulerTourForest::newNode(int vertex)
+    {
+        // xorshift32: prioridades aleatorias mantem a altura esperada em O(log n)
+        seed ^= seed << 13;
+        seed ^= seed >> 17;
+        seed ^= seed << 5;
+        TourNode node = {-1, -1, -1, seed, 1, vertex != 0 ? 1 : 0, vertex, 0, 0};
+        if (!freeNodes.empty())
+        {
+            int x = freeNodes.back();
+            freeNodes.pop_back();
+            nodes[x] = node;
+            return x;
+        }
+        nodes.push_back(node);
+        return static_cast<int>(nodes.size()) - 1;
+    }
+
+    int EulerTourForest::ensureVertex(int v)
+    {
+        if (vertexNode[v] < 0)
+            vertexNode[v] = newNode(v);
+        return vertexNode[v];
+    }
+
+    void EulerTourForest::update(int x)
+    {
+        TourNode &node = nodes[x];
+        node.size = 1;
+        node.vertices = node.vertex != 0 ? 1 : 0;
+        node.any = node.own;
+        for (int child : {node.left, node.right})
+        {
+            if (child < 0)
+                continue;
+            node.size += nodes[child].size;
+            node.vertices += nodes[child].vertices;
+            node.any |= nodes[child].any;
+        }
+    }
+
+    int EulerTourForest::root(int x) const
+    {
+        while (nodes[x].parent >= 0)
+            x = nodes[x].parent;
+        return x;
+    }
+
+    int EulerTourForest::position(int x) const
+    {
+        int left = nodes[x].left;
+        int pos = left >= 0 ? nodes[left].size : 0;
+        for (int parent = nodes[x].parent; parent >= 0; x = parent, parent = nodes[x].parent)
+        {
+            if (nodes[parent].right == x)
+            {
+                left = nodes[parent].left;
+                pos += (left >= 0 ? nodes[left].size : 0) + 1;
+            }
+        }
+        return pos;
+    }
+
+    // Separa os k primeiros nos de t em first e o resto em rest
+    void EulerTourForest::split(int t, int k, int &first, int &rest)
+    {
+        if (t < 0)
+        {
+            first = rest = -1;
+            return;
+        }
+        int left = nodes[t].left;
+        int leftSize = left >= 0 ? nodes[left].size : 0;
+        if (leftSize < k)
+        {
+            int a, b;
+            split(nodes[t].right, k - leftSize - 1, a, b);
+            nodes[t].right = a;
+            if (a >= 0)
+                nodes[a].parent = t;
+            update(t);
+            first = t;
+            rest = b;
+        }
+        else
+        {
+            int a, b;
+            split(left, k, a, b);
+            nodes[t].left = b;
+            if (b >= 0)
+                nodes[b].parent = t;
+            update(t);
+            first = a;
+            rest = t;
+        }
+        if (first >= 0)
+            nodes[first].parent = -1;
+        if (rest >= 0)
+            nodes[rest].parent = -1;
+    }
+
+    int EulerTourForest::merge(int a, int b)
+    {
+        if (a < 0)
+            return b;
+        if (b < 0)
+            return a;
+        if (nodes[a].priority > nodes[b].priority)
+        {
+            int right = merge(nodes[a].right, b);
+            nodes[a].right = right;
+            nodes[right].parent = a;
+            update(a);
+            return a;
+        }
+        int left = merge(a, nodes[b].left);
+        nodes[b].left = left;
+        nodes[left].parent = b;
+        update(b);
+        return b;
+    }
+
+    // Gira o tour para comecar em x; retorna a nova raiz do treap
+    int EulerTourForest::reroot(int x)
+    {
+        int first, rest;
+        split(root(x), position(x), first, rest);
+        int r = merge(rest, first);
+        nodes[r].parent = -1;
+        return r;
+    }
+
+    bool EulerTourForest::connected(int u, int v) const
+    {
+        if (u == v)
+            return true;
+        if (vertexNode[u] < 0 || vertexNode[v] < 0)
+            return false;
+        return root(vertexNode[u]) == root(vertexNode[v]);
+    }
+
+    int EulerTourForest::treeSize(int v) const
+    {
+        return vertexNode[v] < 0 ? 1 : nodes[root(vertexNode[v])].vertices;
+    }
+
+    void EulerTourForest::link(int u, int v, int edge)
+    {
+        int tu = reroot(ensureVertex(u));
+        int tv = reroot(ensureVertex(v));
+        int uv = newNode(0);
+        int vu = newNode(0);
+        // tour(u) + (u, v) + tour(v) + (v, u)
+        int r = merge(merge(merge(tu, uv), tv), vu);
+        nodes[r].parent = -1;
+        arcs[edge] = std::make_pair(uv, vu);
+    }
+
+    void EulerTourForest::cut(int edge)
+    {
+        auto found = arcs.find(edge);
+        int a = found->second.first, b = found->second.second;
+        arcs.erase(found);
+
+        int t = root(a);
+        int pa = position(a), pb = position(b);
+        if (pa > pb)
+        {
+            std::swap(a, b);
+            std::swap(pa, pb);
+        }
+        // A a B b C: B e um dos lados, A + C o outro
+        int before, rest, arc, middle, after;
+        split(t, pa, before, rest);
+        split(rest, 1, arc, rest);
+        split(rest, pb - pa - 1, middle, rest);
+        split(rest, 1, arc, after);
+        int r = merge(before, after);
+        if (r >= 0)
+            nodes[r].parent = -1;
+        freeNodes.push_back(a);
+        freeNodes.push_back(b);
+    }
+
+    void EulerTourForest::setFlags(int v, unsigned flags, bool on)
+    {
+        int x = on ? ensureVertex(v) : vertexNode[v];
+        if (x < 0)
+            return;
+        if (on)
+            nodes[x].own |= flags;
+        else
+            nodes[x].own &= ~flags;
+        for (; x >= 0; x = nodes[x].parent)
+            update(x);
+    }
+
+    int EulerTourForest::findFlagged(int v, unsigned flag) const
+    {
+        if (vertexNode[v] < 0)
+            return 0;
+        int x = root(vertexNode[v]);
+        if (!(nodes[x].any & flag))
+            return 0;
+        while (!(nodes[x].own & flag))
+        {
+            int left = nodes[x].left;
+            x = left >= 0 && (nodes[left].any & flag) ? left : nodes[x].right;
+        }
+        return nodes[x].vertex;
+    }
+
+    DynamicConnectivity::DynamicConnectivity(int vertices) : numVertices(vertices), numEdges(0), components(vertices)
+    {
+        levels.emplace_back(new Level(vertices));
+    }
+
+    DynamicConnectivity::DynamicConnectivity(const Graph &graph) : DynamicConnectivity(graph.getOrder())
+    {
+        // Vertices removidos (ate o compact) nao contam como componentes
+        components = graph.getLiveVertexCount();
+        for (int u = 1; u <= graph.getOrder(); ++u)
+        {
+            bool selfLoopHalf = false; // Um laco aparece duas vezes na lista do vertice
+            for (const Node *adj = graph.getAdjacencyList(u); adj != nullptr; adj = adj->next)
+            {
+                if (adj->vertex == u)
+                {
+                    selfLoopHalf = !selfLoopHalf;
+                    if (!selfLoopHalf)
+                        continue;
+                }
+                if (u <= adj->vertex)
+                    addEdge(u, adj->vertex);
+            }
+        }
+    }
+
+    DynamicConnectivity::Level &DynamicConnectivity::level(int i)
+    {
+        while (static_cast<int>(levels.size()) <= i)
+            levels.emplace_back(new Level(numVertices));
+        return *levels[i];
+    }
+
+    std::uint64_t DynamicConnectivity::key(int u, int v)
+    {
+        if (u > v)
+            std::swap(u, v);
+        return (static_cast<std::uint64_t>(static_cast<std::uint32_t>(u)) << 32) | static_cast<std::uint32_t>(v);
+    }
+
+    // Coloca a aresta nas listas do seu nivel (de arvore ou nao)
+    void DynamicConnectivity::attach(int edge)
+    {
+        EdgeRecord &record = edges[edge];
+        Level &at = level(record.level);
+        auto &lists = record.tree ? at.treeEdges : at.nonTreeEdges;
+        unsigned flag = record.tree ? TREE_EDGES : NON_TREE_EDGES;
+        int endpoints[2] = {record.u, record.v};
+        for (int side = 0; side < (record.u == record.v ? 1 : 2); ++side)
+        {
+            std::vector<int> &list = lists[endpoints[side]];
+            record.position[side] = static_cast<int>(list.size());
+            list.push_back(edge);
+            if (list.size() == 1)
+                at.forest.setFlags(endpoints[side], flag, true);
+        }
+    }
+
+    void DynamicConnectivity::detach(int edge)
+    {
+        EdgeRecord &record = edges[edge];
+        Level &at = *levels[record.level];
+        auto &lists = record.tree ? at.treeEdges : at.nonTreeEdges;
+        unsigned flag = record.tree ? TREE_EDGES : NON_TREE_EDGES;
+        int endpoints[2] = {record.u, record.v};
+        for (int side = 0; side < (record.u == record.v ? 1 : 2); ++side)
+        {
+            int v = endpoints[side];
+            std::vector<int> &list = lists[v];
+            int last = list.back();
+            list[record.position[side]] = last;
+            // Lacos so usam o lado 0; nos outros casos o lado da aresta movida e o da ponta v
+            EdgeRecord &moved = edges[last];
+            moved.position[moved.u == v ? 0 : 1] = record.position[side];
+            list.pop_back();
+            if (list.empty())
+                at.forest.setFlags(v, flag, false);
+        }
+    }
+
+    int DynamicConnectivity::addVertex()
+    {
+        numVertices++;
+        components++;
+        for (auto &at : levels)
+        {
+            at->forest.addVertex();
+            at->treeEdges.emplace_back();
+            at->nonTreeEdges.emplace_back();
+        }
+        return numVertices;
+    }
+
+    void DynamicConnectivity::addEdge(int u, int v)
+    {
+        if (u < 1 || v < 1 || u > numVertices || v > numVertices)
+        {
+            std::cout << "Error: Vertex out of range" << std::endl;
+            return;
+        }
+        int edge;
+        if (!freeEdges.empty())
+        {
+            edge = freeEdges.back();
+            freeEdges.pop_back();
+        }
+        else
+        {
+            edge = static_cast<int>(edges.size());
+            edges.emplace_back();
+        }
+        EdgeRecord &record = edges[edge];
+        record.u = u;
+        record.v = v;
+        record.level = 0;
+        // Liga duas componentes: entra na floresta geradora
+        record.tree = u != v && !levels[0]->forest.connected(u, v);
+        if (record.tree)
+        {
+            levels[0]->forest.link(u, v, edge);
+            components--;
+        }
+        attach(edge);
+        between[key(u, v)].push_back(edge);
+        numEdges++;
+    }
+
+    bool DynamicConnectivity::removeEdge(int u, int v)
+    {
+        if (u < 1 || v < 1 || u > numVertices || v > numVertices)
+            return false;
+        auto found = between.find(key(u, v));
+        if (found == between.end())
+            return false;
+
+        // Entre copias paralelas, remove de preferencia uma que nao e da arvore (sem substituicao)
+        std::vector<int> &copies = found->second;
+        size_t chosen = 0;
+        while (chosen + 1 < copies.size() && edges[copies[chosen]].tree)
+            ++chosen;
+        int edge = copies[chosen];
+        copies[chosen] = copies.back();
+        copies.pop_back();
+        if (copies.empty())
+            between.erase(found);
+
+        EdgeRecord &record = edges[edge];
+        detach(edge);
+        if (record.tree)
+        {
+            for (int i = 0; i <= record.level; ++i)
+                levels[i]->forest.cut(edge);
+            replace(record.u, record.v, record.level);
+        }
+        freeEdges.push_back(edge);
+        numEdges--;
+        return true;
+    }
+
+    // Procura uma aresta que reconecte u e v, do nivel da aresta removida ate o 0
+    void DynamicConnectivity::replace(int u, int v, int topLevel)
+    {
+        for (int i = topLevel; i >= 0; --i)
+        {
+            EulerTourForest &forest = levels[i]->forest;
+            int small = forest.treeSize(u) <= forest.treeSize(v) ? u : v;
+
+            // A arvore menor tem no maximo metade dos vertices: suas arestas de arvore sobem de nivel
+            for (int x; (x = forest.findFlagged(small, TREE_EDGES)) != 0;)
+            {
+                std::vector<int> &list = levels[i]->treeEdges[x];
+                while (!list.empty())
+                {
+                    int edge = list.back();
+                    detach(edge);
+                    edges[edge].level = i + 1;
+                    level(i + 1).forest.link(edges[edge].u, edges[edge].v, edge);
+                    attach(edge);
+                }
+            }
+
+            // Arestas nao-arvore que saem da arvore menor: ou reconectam, ou sobem de nivel
+            for (int x; (x = forest.findFlagged(small, NON_TREE_EDGES)) != 0;)
+            {
+                std::vector<int> &list = levels[i]->nonTreeEdges[x];
+                while (!list.empty())
+                {
+                    int edge = list.back();
+                    EdgeRecord &record = edges[edge];
+                    int y = record.u == x ? record.v : record.u;
+                    detach(edge);
+                    if (forest.connected(small, y))
+                    {
+                        record.level = i + 1;
+                        attach(edge);
+                        continue;
+                    }
+                    record.tree = true;
+                    for (int j = 0; j <= i; ++j)
+                        levels[j]->forest.link(record.u, record.v, edge);
+                    attach(edge);
+                    return;
+                }
+            }
+        }
+        components++;
+    }
+
+    bool DynamicConnectivity::connected(int u, int v) const
+    {
+        return levels[0]->forest.connected(u, v);
+    }
+
+    int DynamicConnectivity::componentSize(int v) const
+    {
+        return levels[0]->forest.treeSize(v);
+    }
+
+} // namespace MyDataStructures
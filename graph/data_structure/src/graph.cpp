@@ -1,23 +1,74 @@
 #include "graph.hpp"
+#include "metrics.hpp"
+#include <atomic>
 
-// copy-constructor: clona todas as listas
+namespace
+{
+    // Versoes unicas entre todos os grafos: mesma versao implica mesmo conteudo
+    std::uint64_t next_version()
+    {
+        static std::atomic<std::uint64_t> counter(0);
+        return counter.fetch_add(1, std::memory_order_relaxed) + 1;
+    }
+
+    // Donos de listas de adjacencia, tambem unicos entre todos os grafos
+    std::uint64_t next_owner()
+    {
+        static std::atomic<std::uint64_t> counter(0);
+        return counter.fetch_add(1, std::memory_order_relaxed) + 1;
+    }
+} // namespace
+
+// copy-constructor: compartilha as listas (ou clona todas, se o alocador nao libera em bloco)
 Graph::Graph(const Graph &other)
-  : numVertices(other.numVertices),
+  : adjacencyList(other.adjacencyList),
+    allocator(other.allocator->createEmpty()),
+    borrowed(other.borrowed),
+    owner(next_owner()),
+    listOwner(other.listOwner),
+    numVertices(other.numVertices),
+    liveVertices(other.liveVertices),
     numEdges(other.numEdges),
     maxDegree(other.maxDegree),
     minDegree(other.minDegree),
     isWeighted(other.isWeighted),
-    adjacencyList(other.numVertices + 1, nullptr)
+    degree(other.degree),
+    degreeCount(other.degreeCount),
+    live(other.live),
+    version(other.version),
+    derived(new DerivedCache())
 {
+    // Mesmo conteudo: a copia aproveita o que ja foi calculado para o original
+    {
+        std::lock_guard<std::mutex> guard(other.derived->lock);
+        for (int p = 0; p < DERIVED_PROPERTY_COUNT; ++p)
+            derived->value[p] = other.derived->value[p];
+        derived->populated = other.derived->populated;
+    }
+    GRAPH_METRICS_ADD(GraphCopies, 1);
+    GRAPH_METRICS_ADD(VerticesTouched, numVertices);
+    if (allocator->releasesInBulk())
+    {
+        // Nenhuma lista fica sendo so de um dos dois: quem mudar uma primeiro a duplica.
+        // Os nos compartilhados vivem enquanto algum dos grafos segurar o alocador deles
+        borrowed.push_back(other.allocator);
+        other.owner.store(next_owner(), std::memory_order_relaxed);
+        return;
+    }
+
+    // Cada no precisa ser liberado por exatamente um grafo: copia profunda
+    GRAPH_METRICS_ADD(EdgesTouched, 2 * static_cast<uint64_t>(numEdges));
+    adjacencyList.assign(numVertices + 1, nullptr);
+    listOwner.assign(numVertices + 1, owner.load(std::memory_order_relaxed));
     // Para cada vértice, percorre a lista original e vai clonando nó a nó
     for (int u = 1; u <= numVertices; ++u) {
         auto src = other.adjacencyList[u];
         // ponteiro para inserir em adjacencyList[u]
-        std::shared_ptr<Node>* dstPtr = &adjacencyList[u];
+        Node** dstPtr = &adjacencyList[u];
 
         while (src) {
             // cria um novo Node com o mesmo valor e peso
-            *dstPtr = std::make_shared<Node>(src->vertex, src->weight);
+            *dstPtr = allocator->allocate(src->vertex, src->weight);
             // avança o ponteiro de destino para o próximo campo next
             dstPtr = &((*dstPtr)->next);
             // avança no fonte
@@ -26,37 +77,210 @@ Graph::Graph(const Graph &other)
     }
 }
 
+// constroi as listas a partir de um CsrGraph, na mesma ordem dos vizinhos
+Graph::Graph(const CsrGraph &snapshot)
+  : adjacencyList(snapshot.getOrder() + 1, nullptr),
+    allocator(new ArenaNodeAllocator()),
+    owner(next_owner()),
+    listOwner(snapshot.getOrder() + 1, owner.load(std::memory_order_relaxed)),
+    numVertices(snapshot.getOrder()),
+    liveVertices(snapshot.getOrder()),
+    numEdges(snapshot.getSize()),
+    maxDegree(0),
+    minDegree(0),
+    isWeighted(snapshot.getIsWeighted()),
+    degree(snapshot.getOrder() + 1, 0),
+    live(snapshot.getOrder() + 1, true),
+    version(next_version()),
+    derived(new DerivedCache())
+{
+    for (int u = 1; u <= numVertices; ++u) {
+        Node** dstPtr = &adjacencyList[u];
+        for (uint64_t e = snapshot.edgeBegin(u); e < snapshot.edgeEnd(u); ++e) {
+            *dstPtr = allocator->allocate(snapshot.target(e), snapshot.weight(e));
+            dstPtr = &((*dstPtr)->next);
+        }
+        degree[u] = snapshot.getVertexDegree(u);
+    }
+    rebuildDegreeHistogram();
+}
+
+// move-constructor: toma posse das listas e do alocador de other
+Graph::Graph(Graph &&other) noexcept
+  : adjacencyList(std::move(other.adjacencyList)),
+    allocator(std::move(other.allocator)),
+    borrowed(std::move(other.borrowed)),
+    owner(other.owner.load(std::memory_order_relaxed)),
+    listOwner(std::move(other.listOwner)),
+    numVertices(other.numVertices),
+    liveVertices(other.liveVertices),
+    numEdges(other.numEdges),
+    maxDegree(other.maxDegree),
+    minDegree(other.minDegree),
+    isWeighted(other.isWeighted),
+    degree(std::move(other.degree)),
+    degreeCount(std::move(other.degreeCount)),
+    live(std::move(other.live)),
+    version(other.version),
+    derived(std::move(other.derived))
+{
+    other.adjacencyList.assign(1, nullptr);
+    other.allocator = allocator->createEmpty();
+    other.borrowed.clear();
+    other.owner.store(next_owner(), std::memory_order_relaxed);
+    other.listOwner.assign(1, other.owner.load(std::memory_order_relaxed));
+    other.numVertices = other.liveVertices = other.numEdges = other.maxDegree = other.minDegree = 0;
+    other.degree.assign(1, 0);
+    other.degreeCount.assign(1, 0);
+    other.live.assign(1, true);
+    other.version = next_version();
+    other.derived.reset(new DerivedCache());
+}
+
+Graph &Graph::operator=(Graph other) noexcept
+{
+    std::swap(adjacencyList, other.adjacencyList);
+    std::swap(allocator, other.allocator);
+    std::swap(borrowed, other.borrowed);
+    std::swap(listOwner, other.listOwner);
+    std::uint64_t ours = owner.load(std::memory_order_relaxed);
+    owner.store(other.owner.load(std::memory_order_relaxed), std::memory_order_relaxed);
+    other.owner.store(ours, std::memory_order_relaxed);
+    std::swap(numVertices, other.numVertices);
+    std::swap(liveVertices, other.liveVertices);
+    std::swap(numEdges, other.numEdges);
+    std::swap(maxDegree, other.maxDegree);
+    std::swap(minDegree, other.minDegree);
+    std::swap(isWeighted, other.isWeighted);
+    std::swap(degree, other.degree);
+    std::swap(degreeCount, other.degreeCount);
+    std::swap(live, other.live);
+    std::swap(version, other.version);
+    std::swap(derived, other.derived);
+    return *this;
+}
+
 /**
- * @brief Calculate the degree of a vertex
- * @param vertex The vertex to calculate degree for
- * @return The degree of the vertex
+ * @brief Destructor, gives every node back to the allocator
  */
-int Graph::calculateDegree(int vertex) const
+Graph::~Graph()
 {
-    int degree = 0;
-    auto current = adjacencyList[vertex];
-    while (current != nullptr)
+    // Uma arena libera todos os nos de uma vez ao ser destruida
+    if (!allocator || allocator->releasesInBulk())
+        return;
+    std::uint64_t ours = owner.load(std::memory_order_relaxed);
+    for (int v = 0; v <= numVertices; ++v)
     {
-        degree++;
-        current = current->next;
+        if (listOwner[v] != ours)
+            continue; // Nos de outro grafo
+        Node *head = adjacencyList[v];
+        while (head != nullptr)
+        {
+            Node *next = head->next;
+            allocator->release(head);
+            head = next;
+        }
     }
-    return degree;
 }
 
 /**
- * @brief Update max and min degrees after adding an edge
+ * @brief Increase the degree of a vertex by one, keeping min/max degree in O(1)
+ * @param vertex The vertex that gained a half-edge
  */
-void Graph::updateDegrees()
+void Graph::incrementDegree(int vertex)
+{
+    int d = degree[vertex]++;
+    if (static_cast<int>(degreeCount.size()) <= d + 1)
+        degreeCount.resize(d + 2, 0);
+    degreeCount[d]--;
+    degreeCount[d + 1]++;
+
+    maxDegree = std::max(maxDegree, d + 1);
+    // O unico vertice com grau minimo pode ter saido desse grau
+    if (d == minDegree && degreeCount[d] == 0)
+        minDegree = d + 1;
+}
+
+/**
+ * @brief Decrease the degree of a vertex by one, keeping min/max degree in O(1)
+ * @param vertex The vertex that lost a half-edge
+ */
+void Graph::decrementDegree(int vertex)
+{
+    int d = degree[vertex]--;
+    degreeCount[d]--;
+    degreeCount[d - 1]++;
+
+    minDegree = std::min(minDegree, d - 1);
+    if (d == maxDegree && degreeCount[d] == 0)
+        maxDegree = d - 1;
+}
+
+/**
+ * @brief Make the list of a vertex only ours, duplicating it if it is shared, in O(d(v))
+ * @param vertex The vertex whose list is about to be changed in place
+ */
+void Graph::ownList(int vertex)
+{
+    std::uint64_t ours = owner.load(std::memory_order_relaxed);
+    if (listOwner[vertex] == ours)
+        return;
+    // Os nos antigos continuam sendo usados por outro grafo: nao sao liberados
+    Node **dstPtr = &adjacencyList[vertex];
+    for (const Node *src = *dstPtr; src != nullptr; src = src->next)
+    {
+        *dstPtr = allocator->allocate(src->vertex, src->weight);
+        dstPtr = &((*dstPtr)->next);
+    }
+    listOwner[vertex] = ours;
+    GRAPH_METRICS_ADD(EdgesTouched, degree[vertex]);
+}
+
+/**
+ * @brief Start a new version: drop every memoized result
+ */
+void Graph::changed()
+{
+    version = next_version();
+    discardDerived();
+}
+
+/**
+ * @brief Drop the memoized results without changing the graph (the version stays the same)
+ */
+void Graph::discardDerived()
+{
+    // Quem modifica o grafo tem acesso exclusivo: nao precisa da trava
+    if (!derived->populated)
+        return;
+    for (int p = 0; p < DERIVED_PROPERTY_COUNT; ++p)
+        derived->value[p].reset();
+    derived->populated = false;
+}
+
+/**
+ * @brief Rebuild the degree histogram and min/max degree from the degree array
+ */
+void Graph::rebuildDegreeHistogram()
 {
     maxDegree = 0;
-    minDegree = numVertices; // Initialize with maximum possible value
+    minDegree = 0;
+    degreeCount.assign(1, 0);
+    if (liveVertices == 0)
+        return;
 
-    for (int i = 1; i <= numVertices; i++)
+    for (int v = 1; v <= numVertices; v++)
     {
-        int degree = calculateDegree(i);
-        maxDegree = std::max(maxDegree, degree);
-        minDegree = std::min(minDegree, degree);
+        if (!live[v])
+            continue;
+        if (static_cast<int>(degreeCount.size()) <= degree[v])
+            degreeCount.resize(degree[v] + 1, 0);
+        degreeCount[degree[v]]++;
     }
+
+    maxDegree = static_cast<int>(degreeCount.size()) - 1;
+    while (degreeCount[minDegree] == 0)
+        minDegree++;
 }
 
 /**
@@ -64,10 +288,19 @@ void Graph::updateDegrees()
  * @param vertices Number of vertices in the graph
  * @param weighted Whether the graph is weighted
  */
-Graph::Graph(int vertices, bool weighted) : numVertices(vertices), numEdges(0), maxDegree(0), minDegree(0), isWeighted(weighted)
+Graph::Graph(int vertices, bool weighted, std::unique_ptr<NodeAllocator> nodeAllocator)
+    : allocator(std::move(nodeAllocator)), owner(next_owner()), numVertices(vertices), liveVertices(vertices), numEdges(0),
+      maxDegree(0), minDegree(0), isWeighted(weighted), version(next_version()), derived(new DerivedCache())
 {
+    if (!allocator)
+        allocator.reset(new ArenaNodeAllocator());
+
     // Initialize adjacency list with nullptr for each vertex
     adjacencyList.resize(vertices + 1, nullptr);
+    listOwner.assign(vertices + 1, owner.load(std::memory_order_relaxed));
+    degree.assign(vertices + 1, 0);
+    live.assign(vertices + 1, true);
+    rebuildDegreeHistogram();
 }
 
 /**
@@ -77,8 +310,14 @@ Graph::Graph(int vertices, bool weighted) : numVertices(vertices), numEdges(0),
 int Graph::addVertex()
 {
     numVertices++;
+    liveVertices++;
     adjacencyList.push_back(nullptr);
-    updateDegrees();
+    listOwner.push_back(owner.load(std::memory_order_relaxed));
+    degree.push_back(0);
+    live.push_back(true);
+    degreeCount[0]++;
+    minDegree = 0;
+    changed();
     return numVertices;
 }
 
@@ -91,7 +330,7 @@ int Graph::addVertex()
 void Graph::addEdge(int u, int v, int weight)
 {
     // Check if vertices exist
-    if (u > numVertices || v > numVertices)
+    if (!isVertexLive(u) || !isVertexLive(v))
     {
         std::cout << "Error: Vertex out of range" << std::endl;
         return;
@@ -103,17 +342,54 @@ void Graph::addEdge(int u, int v, int weight)
     }
 
     // Add edge from u to v
-    auto newNode = std::make_shared<Node>(v, weight);
+    Node *newNode = allocator->allocate(v, weight);
     newNode->next = adjacencyList[u];
     adjacencyList[u] = newNode;
 
     // Add edge from v to u (undirected graph)
-    newNode = std::make_shared<Node>(u, weight);
+    newNode = allocator->allocate(u, weight);
     newNode->next = adjacencyList[v];
     adjacencyList[v] = newNode;
 
     numEdges++;
-    updateDegrees();
+    incrementDegree(u);
+    incrementDegree(v);
+    changed();
+    GRAPH_METRICS_ADD(EdgesAdded, 1);
+}
+
+/**
+ * @brief Add many edges at once, updating the degree bookkeeping a single time
+ * @param edges The edges to add (weights are ignored if the graph is not weighted)
+ */
+void Graph::addEdges(const std::vector<Edge> &edges)
+{
+    GRAPH_METRICS_SCOPE("graph_add_edges");
+    for (const Edge &edge : edges)
+    {
+        if (!isVertexLive(edge.u) || !isVertexLive(edge.v))
+        {
+            std::cout << "Error: Vertex out of range" << std::endl;
+            continue;
+        }
+        int weight = isWeighted ? edge.weight : 1;
+
+        Node *newNode = allocator->allocate(edge.v, weight);
+        newNode->next = adjacencyList[edge.u];
+        adjacencyList[edge.u] = newNode;
+
+        newNode = allocator->allocate(edge.u, weight);
+        newNode->next = adjacencyList[edge.v];
+        adjacencyList[edge.v] = newNode;
+
+        degree[edge.u]++;
+        degree[edge.v]++;
+        numEdges++;
+    }
+    rebuildDegreeHistogram();
+    changed();
+    GRAPH_METRICS_ADD(EdgesAdded, edges.size()); // inclui as arestas rejeitadas acima
+    GRAPH_METRICS_ADD(VerticesTouched, numVertices);
 }
 
 /**
@@ -134,6 +410,25 @@ int Graph::getSize() const
     return numEdges;
 }
 
+/**
+ * @brief Get the number of vertices that were not removed
+ * @return Number of live vertices
+ */
+int Graph::getLiveVertexCount() const
+{
+    return liveVertices;
+}
+
+/**
+ * @brief Check if a vertex id is in range and was not removed
+ * @param vertex The vertex to check
+ * @return true if the vertex exists
+ */
+bool Graph::isVertexLive(int vertex) const
+{
+    return vertex >= 1 && vertex <= numVertices && live[vertex];
+}
+
 /**
  * @brief Get the maximum degree of any vertex in the graph
  * @return Maximum degree
@@ -159,7 +454,7 @@ int Graph::getMinDegree() const
  */
 int Graph::getVertexDegree(int vertex) const
 {
-    return calculateDegree(vertex);
+    return degree[vertex];
 }
 
 /**
@@ -167,18 +462,51 @@ int Graph::getVertexDegree(int vertex) const
  * @param vertex The vertex to get the adjacency list for
  * @return Pointer to the first node in the adjacency list
  */
-std::shared_ptr<Node> Graph::getAdjacencyList(int vertex) const
+const Node *Graph::getAdjacencyList(int vertex) const
 {
     return adjacencyList[vertex];
 }
 
+/**
+ * @brief Get the counters of the node allocator
+ * @return Allocation statistics since the graph was created
+ */
+const AllocationStats &Graph::getAllocationStats() const
+{
+    return allocator->getStats();
+}
+
+/**
+ * @brief Pack the graph into an immutable CSR snapshot for read-only algorithms
+ * @return Snapshot with contiguous offsets, targets and weights
+ */
+CsrGraph Graph::freeze() const
+{
+    return *memoize<CsrGraph>(DerivedProperty::Snapshot, [this]() {
+        GRAPH_METRICS_SCOPE("freeze");
+        GRAPH_METRICS_ADD(Snapshots, 1);
+        GRAPH_METRICS_ADD(VerticesTouched, numVertices);
+        GRAPH_METRICS_ADD(EdgesTouched, 2 * static_cast<uint64_t>(numEdges));
+        return CsrGraph(*this);
+    });
+}
+
+/**
+ * @brief Version of the graph, new on every change
+ * @return The current version
+ */
+std::uint64_t Graph::getVersion() const
+{
+    return version;
+}
+
 /**
  * @brief Print the graph structure and properties
  */
 void Graph::printGraph() const
 {
     std::cout << "Graph Properties:" << std::endl;
-    std::cout << "Order (vertices): " << numVertices << std::endl;
+    std::cout << "Order (vertices): " << liveVertices << std::endl;
     std::cout << "Size (edges): " << numEdges << std::endl;
     std::cout << "Maximum degree: " << maxDegree << std::endl;
     std::cout << "Minimum degree: " << minDegree << std::endl;
@@ -187,7 +515,9 @@ void Graph::printGraph() const
 
     for (int i = 1; i <= numVertices; i++)
     {
-        std::cout << "Vertex " << i << " (degree " << calculateDegree(i) << ") -> ";
+        if (!live[i])
+            continue;
+        std::cout << "Vertex " << i << " (degree " << degree[i] << ") -> ";
         auto current = adjacencyList[i];
         while (current != nullptr)
         {
@@ -211,16 +541,29 @@ void Graph::printGraph() const
 bool Graph::removeEdge(int u, int v)
 {
     // Check if vertices exist
-    if (u > numVertices || v > numVertices)
+    if (u < 1 || v < 1 || u > numVertices || v > numVertices)
     {
         return false;
     }
 
+    std::uint64_t ours = owner.load(std::memory_order_relaxed);
+    if (listOwner[u] != ours || listOwner[v] != ours)
+    {
+        // Listas compartilhadas so sao duplicadas se a aresta existe
+        const Node *edge = adjacencyList[u];
+        while (edge != nullptr && edge->vertex != v)
+            edge = edge->next;
+        if (edge == nullptr)
+            return false;
+        ownList(u);
+        ownList(v);
+    }
+
     bool edgeRemoved = false;
 
     // Remove edge from u's adjacency list
-    auto current = adjacencyList[u];
-    std::shared_ptr<Node> prev = nullptr;
+    Node *current = adjacencyList[u];
+    Node *prev = nullptr;
     while (current != nullptr)
     {
         if (current->vertex == v)
@@ -233,6 +576,7 @@ bool Graph::removeEdge(int u, int v)
             {
                 prev->next = current->next;
             }
+            allocator->release(current);
             edgeRemoved = true;
             break;
         }
@@ -255,6 +599,7 @@ bool Graph::removeEdge(int u, int v)
             {
                 prev->next = current->next;
             }
+            allocator->release(current);
             break;
         }
         prev = current;
@@ -264,52 +609,138 @@ bool Graph::removeEdge(int u, int v)
     if (edgeRemoved)
     {
         numEdges--;
-        updateDegrees();
+        decrementDegree(u);
+        decrementDegree(v);
+        changed();
+        GRAPH_METRICS_ADD(EdgesRemoved, 1);
     }
 
     return edgeRemoved;
 }
 
 /**
- * @brief Remove a vertex and all its incident edges
+ * @brief Remove a vertex and all its incident edges, leaving a tombstone
  * @param vertex The vertex to remove
- * @return true if vertex was removed, false if vertex didn't exist
+ * @return true if vertex was removed, false if vertex didn't exist or was already removed
  */
 bool Graph::removeVertex(int v) {
-    // 1) verifica existência
-    if (v < 1 || v > numVertices) 
+    if (!isVertexLive(v))
         return false;
 
-    // 2) coleta vizinhos de v
+    // 1) solta os nos de v; cada vizinho distinto e visitado uma vez so, mesmo com arestas paralelas
+    //    (uma lista compartilhada com outro grafo so deixa de ser usada aqui)
     std::vector<int> neigh;
-    for (auto curr = adjacencyList[v]; curr; curr = curr->next)
-        neigh.push_back(curr->vertex);
+    int loopHalves = 0;
+    bool ownsList = listOwner[v] == owner.load(std::memory_order_relaxed);
+    for (Node *curr = adjacencyList[v]; curr != nullptr;) {
+        Node *next = curr->next;
+        if (curr->vertex == v)
+            loopHalves++;
+        else
+            neigh.push_back(curr->vertex);
+        if (ownsList)
+            allocator->release(curr);
+        curr = next;
+    }
+    adjacencyList[v] = nullptr;
+    std::sort(neigh.begin(), neigh.end());
+    neigh.erase(std::unique(neigh.begin(), neigh.end()), neigh.end());
 
-    // 3) remove todas as arestas (v, w) usando removeEdge,
-    //    que já ajusta numEdges e degrees corretamente
+    // 2) uma passada na lista de cada vizinho remove todos os nos que apontam para v
+    int removedEdges = loopHalves / 2;
+    uint64_t scanned = 0;
     for (int w : neigh) {
-        removeEdge(v, w);
+        ownList(w);
+        Node **link = &adjacencyList[w];
+        while (*link != nullptr) {
+            ++scanned;
+            Node *curr = *link;
+            if (curr->vertex != v) {
+                link = &curr->next;
+                continue;
+            }
+            *link = curr->next;
+            allocator->release(curr);
+            decrementDegree(w);
+            decrementDegree(v);
+            removedEdges++;
+        }
     }
+    for (int i = 0; i < loopHalves; ++i)
+        decrementDegree(v);
+    numEdges -= removedEdges;
+
+    // 3) tombstone: v sai do histograma de graus, os outros ids nao mudam
+    degreeCount[0]--;
+    live[v] = false;
+    liveVertices--;
+    if (liveVertices == 0)
+    {
+        minDegree = maxDegree = 0;
+    }
+    else
+    {
+        while (degreeCount[minDegree] == 0)
+            minDegree++;
+    }
+    changed();
+    GRAPH_METRICS_ADD(EdgesRemoved, removedEdges);
+    GRAPH_METRICS_ADD(VerticesTouched, 1 + neigh.size());
+    GRAPH_METRICS_ADD(EdgesTouched, scanned);
+    return true;
+}
 
-    // 4) remove a própria linha de adjacência de v
-    //    (shiftará automaticamente as posições > v)
-    adjacencyList.erase(adjacencyList.begin() + v);
-
-    // 5) decrementa o contador de vértices
-    numVertices--;
+/**
+ * @brief Renumber the live vertices 1..getLiveVertexCount(), keeping their order, in one pass
+ * @return mapping[old id] = new id, or 0 for a removed vertex
+ */
+std::vector<int> Graph::compact()
+{
+    std::vector<int> mapping(numVertices + 1, 0);
+    int next = 0;
+    for (int v = 1; v <= numVertices; ++v)
+    {
+        if (live[v])
+            mapping[v] = ++next;
+    }
+    if (next == numVertices)
+        return mapping; // Nada removido: os ids ja sao 1..n
+    GRAPH_METRICS_SCOPE("graph_compact");
 
-    // 6) reindexa todos os nomes de vértices > v
-    for (int u = 1; u <= numVertices; ++u) {
-        for (auto curr = adjacencyList[u]; curr; curr = curr->next) {
-            if (curr->vertex > v)
-                --curr->vertex;
+    // mapping[v] <= v: mover as linhas para frente, em ordem, nunca sobrescreve uma linha ainda nao lida
+    std::uint64_t ours = owner.load(std::memory_order_relaxed);
+    for (int v = 1; v <= numVertices; ++v)
+    {
+        if (!live[v])
+            continue;
+        if (listOwner[v] == ours)
+        {
+            for (Node *curr = adjacencyList[v]; curr != nullptr; curr = curr->next)
+                curr->vertex = mapping[curr->vertex];
+        }
+        else
+        {
+            // Lista compartilhada: a duplicata ja sai com os ids novos
+            Node **dstPtr = &adjacencyList[v];
+            for (const Node *src = *dstPtr; src != nullptr; src = src->next)
+            {
+                *dstPtr = allocator->allocate(mapping[src->vertex], src->weight);
+                dstPtr = &((*dstPtr)->next);
+            }
         }
+        adjacencyList[mapping[v]] = adjacencyList[v];
+        degree[mapping[v]] = degree[v];
     }
-
-    // 7) finalmente, recalcula min/max degree
-    updateDegrees();
-
-    return true;
+    adjacencyList.resize(next + 1);
+    listOwner.assign(next + 1, ours);
+    borrowed.clear(); // Nenhum no de outro grafo sobrou
+    degree.resize(next + 1);
+    live.assign(next + 1, true);
+    GRAPH_METRICS_ADD(VerticesTouched, numVertices);
+    GRAPH_METRICS_ADD(EdgesTouched, 2 * static_cast<uint64_t>(numEdges));
+    numVertices = next;
+    changed();
+    return mapping;
 }
 
 /**
@@ -327,6 +758,8 @@ bool Graph::getIsWeighted() const
  */
 void Graph::setIsWeighted(bool weighted)
 {
+    if (weighted != isWeighted)
+        changed();
     isWeighted = weighted;
 }
 
@@ -0,0 +1,115 @@
+#include "indexed_heap.hpp"
+#include "metrics.hpp"
+
+namespace MyDataStructures
+{
+
+    const int IndexedHeap::ARITY;
+    const int IndexedHeap::ABSENT;
+
+    IndexedHeap::IndexedHeap(int capacity) : position(capacity, ABSENT), key(capacity, 0)
+    {
+        heap.reserve(capacity);
+    }
+
+    void IndexedHeap::push(int item, std::int64_t itemKey)
+    {
+        GRAPH_METRICS_ADD(HeapOperations, 1);
+        key[item] = itemKey;
+        position[item] = static_cast<int>(heap.size());
+        heap.push_back(item);
+        siftUp(position[item]);
+    }
+
+    void IndexedHeap::decreaseKey(int item, std::int64_t itemKey)
+    {
+        if (itemKey >= key[item])
+            return;
+        GRAPH_METRICS_ADD(HeapOperations, 1);
+        key[item] = itemKey;
+        siftUp(position[item]);
+    }
+
+    bool IndexedHeap::pushOrDecrease(int item, std::int64_t itemKey)
+    {
+        if (!contains(item))
+        {
+            push(item, itemKey);
+            return true;
+        }
+        if (itemKey >= key[item])
+            return false;
+        decreaseKey(item, itemKey);
+        return true;
+    }
+
+    int IndexedHeap::pop()
+    {
+        GRAPH_METRICS_ADD(HeapOperations, 1);
+        int item = heap[0];
+        position[item] = ABSENT;
+        int last = heap.back();
+        heap.pop_back();
+        if (!heap.empty())
+        {
+            heap[0] = last;
+            position[last] = 0;
+            siftDown(0);
+        }
+        return item;
+    }
+
+    void IndexedHeap::clear()
+    {
+        for (int item : heap)
+            position[item] = ABSENT;
+        heap.clear();
+    }
+
+    void IndexedHeap::siftUp(int index)
+    {
+        // Sobe o item movendo os pais para baixo, sem trocas
+        int item = heap[index];
+        std::int64_t itemKey = key[item];
+        while (index > 0)
+        {
+            int parent = (index - 1) / ARITY;
+            if (key[heap[parent]] <= itemKey)
+                break;
+            heap[index] = heap[parent];
+            position[heap[index]] = index;
+            index = parent;
+        }
+        heap[index] = item;
+        position[item] = index;
+    }
+
+    void IndexedHeap::siftDown(int index)
+    {
+        int item = heap[index];
+        std::int64_t itemKey = key[item];
+        const int count = static_cast<int>(heap.size());
+        while (true)
+        {
+            int first = index * ARITY + 1;
+            if (first >= count)
+                break;
+            // Menor dos ate ARITY filhos
+            int best = first;
+            int last = first + ARITY < count ? first + ARITY : count;
+            for (int child = first + 1; child < last; ++child)
+            {
+                if (key[heap[child]] < key[heap[best]])
+                    best = child;
+            }
+            if (key[heap[best]] >= itemKey)
+                break;
+            heap[index] = heap[best];
+            position[heap[index]] = index;
+            index = best;
+        }
+        heap[index] = item;
+        position[item] = index;
+    }
+
+} // namespace MyDataStructures
@@ -0,0 +1,68 @@
+#include "node_allocator.hpp"
+#include <algorithm>
+
+namespace MyDataStructures
+{
+
+    ArenaNodeAllocator::ArenaNodeAllocator() : freeList(nullptr), nextSlabSize(MIN_SLAB_SIZE) {}
+
+    Node *ArenaNodeAllocator::allocate(int vertex, int weight)
+    {
+        stats.nodeAllocations++;
+
+        // Reaproveita um no liberado por removeEdge
+        if (freeList != nullptr)
+        {
+            Node *node = freeList;
+            freeList = node->next;
+            node->vertex = vertex;
+            node->weight = weight;
+            node->next = nullptr;
+            stats.nodesReused++;
+            return node;
+        }
+
+        // A capacidade de cada slab e reservada uma unica vez, entao os ponteiros
+        // para os nos ja entregues nunca sao invalidados
+        if (slabs.empty() || slabs.back().size() == slabs.back().capacity())
+        {
+            slabs.emplace_back();
+            slabs.back().reserve(nextSlabSize);
+            nextSlabSize = std::min(nextSlabSize * 2, MAX_SLAB_SIZE);
+            stats.heapAllocations++;
+        }
+        slabs.back().emplace_back(vertex, weight);
+        return &slabs.back().back();
+    }
+
+    void ArenaNodeAllocator::release(Node *node)
+    {
+        stats.nodeReleases++;
+        node->next = freeList;
+        freeList = node;
+    }
+
+    std::unique_ptr<NodeAllocator> ArenaNodeAllocator::createEmpty() const
+    {
+        return std::unique_ptr<NodeAllocator>(new ArenaNodeAllocator());
+    }
+
+    Node *HeapNodeAllocator::allocate(int vertex, int weight)
+    {
+        stats.nodeAllocations++;
+        stats.heapAllocations++;
+        return new Node(vertex, weight);
+    }
+
+    void HeapNodeAllocator::release(Node *node)
+    {
+        stats.nodeReleases++;
+        delete node;
+    }
+
+    std::unique_ptr<NodeAllocator> HeapNodeAllocator::createEmpty() const
+    {
+        return std::unique_ptr<NodeAllocator>(new HeapNodeAllocator());
+    }
+
+} // namespace MyDataStructures
@@ -0,0 +1,155 @@
+#include <chrono>
+#include <climits>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <string>
+#include <vector>
+#include "binary_graph.hpp"
+#include "csr_graph.hpp"
+#include "edge_list_writer.hpp"
+#include "graph_generators.hpp"
+using namespace std;
+
+namespace
+{
+    void usage(const char *program)
+    {
+        cerr << "Usage: " << program << " <family> [options] --output=<file|->\n"
+             << "Families:\n"
+             << "  gnp       --n=N --p=P\n"
+             << "  gnm       --n=N --m=M\n"
+             << "  rmat      --scale=S --m=M [--a=0.57 --b=0.19 --c=0.19]\n"
+             << "  grid      --x=X --y=Y [--z=Z]\n"
+             << "  complete  --n=N\n"
+             << "  eulerian  --n=N --m=M [--open]\n"
+             << "Options: --seed=S --weights=MAX (weights 1..MAX) --format=text|binary|csr" << endl;
+    }
+
+    bool parse_option(const string &argument, const char *name, string &value)
+    {
+        size_t length = strlen(name);
+        if (argument.compare(0, length, name) != 0 || argument.size() <= length || argument[length] != '=')
+            return false;
+        value = argument.substr(length + 1);
+        return true;
+    }
+} // namespace
+
+/**
+ * @brief Writes a seeded synthetic graph in the "n m / u v [w]" text format, as a binary edge list
+ * or as a binary CSR snapshot (GRAPHCSR, opened with mmap by the program)
+ *
+ * Edge lists are streamed to the output in batches, so the memory used does not grow with the
+ * graph; a CSR snapshot is built in memory first. Progress and throughput go to stderr.
+ */
+int main(int argc, char const *argv[])
+{
+    if (argc < 2)
+    {
+        usage(argv[0]);
+        return 1;
+    }
+
+    GraphSpec spec;
+    if (!parse_graph_family(argv[1], spec.family))
+    {
+        cerr << "Error: unknown family " << argv[1] << endl;
+        usage(argv[0]);
+        return 1;
+    }
+
+    string outputPath;
+    EdgeListFormat format = EdgeListFormat::Text;
+    bool csr = false; // Snapshot CSR (GRAPHCSR, binary_graph.hpp) em vez de lista de arestas
+    for (int i = 2; i < argc; ++i)
+    {
+        string argument = argv[i], value;
+        if (parse_option(argument, "--n", value))
+            spec.vertices = strtoull(value.c_str(), nullptr, 10);
+        else if (parse_option(argument, "--m", value))
+            spec.edges = strtoull(value.c_str(), nullptr, 10);
+        else if (parse_option(argument, "--p", value))
+            spec.probability = atof(value.c_str());
+        else if (parse_option(argument, "--scale", value))
+            spec.scale = atoi(value.c_str());
+        else if (parse_option(argument, "--a", value))
+            spec.a = atof(value.c_str());
+        else if (parse_option(argument, "--b", value))
+            spec.b = atof(value.c_str());
+        else if (parse_option(argument, "--c", value))
+            spec.c = atof(value.c_str());
+        else if (parse_option(argument, "--x", value))
+            spec.x = strtoull(value.c_str(), nullptr, 10);
+        else if (parse_option(argument, "--y", value))
+            spec.y = strtoull(value.c_str(), nullptr, 10);
+        else if (parse_option(argument, "--z", value))
+            spec.z = strtoull(value.c_str(), nullptr, 10);
+        else if (argument == "--open")
+            spec.openTrail = true;
+        else if (parse_option(argument, "--seed", value))
+            spec.seed = strtoull(value.c_str(), nullptr, 10);
+        else if (parse_option(argument, "--weights", value))
+            spec.maxWeight = atoi(value.c_str());
+        else if (parse_option(argument, "--output", value))
+            outputPath = value;
+        else if (argument == "--format=text" || argument == "--format=binary")
+        {
+            format = argument == "--format=text" ? EdgeListFormat::Text : EdgeListFormat::Binary;
+            csr = false;
+        }
+        else if (argument == "--format=csr")
+            csr = true;
+        else
+        {
+            cerr << "Error: unknown option " << argument << endl;
+            usage(argv[0]);
+            return 1;
+        }
+    }
+    if (outputPath.empty())
+    {
+        cerr << "Error: missing --output" << endl;
+        usage(argv[0]);
+        return 1;
+    }
+    if (!validate_spec(spec))
+        return 1;
+
+    auto start = chrono::steady_clock::now();
+    const uint64_t vertices = generated_vertices(spec);
+    const uint64_t edges = generated_edges(spec); // G(n, p): uma passada so para contar
+
+    if (csr)
+    {
+        // O snapshot precisa de todas as arestas na memoria, ao contrario das listas de arestas
+        if (vertices > INT_MAX || edges > INT_MAX || outputPath == "-")
+        {
+            cerr << "Error: --format=csr needs an output file and at most " << INT_MAX << " vertices and edges" << endl;
+            return 1;
+        }
+        vector<Edge> all;
+        all.reserve(edges);
+        bool ok = generate_graph(spec, [&all](const Edge *batch, size_t count) {
+            all.insert(all.end(), batch, batch + count);
+            return true;
+        });
+        if (!ok || !save_binary(CsrGraph::undirected(static_cast<int>(vertices), all, spec.maxWeight > 0), outputPath))
+            return 1;
+    }
+    else
+    {
+        EdgeListWriter writer;
+        if (!writer.open(outputPath, format, vertices, edges, spec.maxWeight > 0))
+            return 1;
+        bool ok = generate_graph(spec, [&writer](const Edge *batch, size_t count) { return writer.write(batch, count); });
+        ok = writer.close() && ok;
+        if (!ok)
+            return 1;
+    }
+
+    double seconds = chrono::duration<double>(chrono::steady_clock::now() - start).count();
+    cerr << "Gerado: " << vertices << " vertices, " << edges << " arestas em " << seconds << " s ("
+         << (seconds > 0 ? edges / seconds / 1e6 : 0.0) << " M arestas/s)" << endl;
+    return 0;
+}
@@ -0,0 +1,97 @@
+#ifndef GRAPH_GENERATORS_HPP
+#define GRAPH_GENERATORS_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <string>
+#include "graph.hpp"
+#include "myDS.hpp"
+
+using namespace MyDataStructures;
+
+/**
+ * @brief Families of synthetic graphs
+ */
+enum class GraphFamily
+{
+    Gnp,      // Erdős–Rényi G(n, p): every pair is an edge with probability p
+    Gnm,      // Erdős–Rényi G(n, m): m distinct pairs chosen uniformly
+    Rmat,     // R-MAT power-law graph: 2^scale vertices, m edges (may repeat)
+    Grid,     // 2D (z = 1) or 3D grid, like a road network
+    Complete, // K_n
+    Eulerian  // Cycle through every vertex plus a closed random walk: every degree is even
+};
+
+/**
+ * @brief Parameters of a synthetic graph; the same spec and seed always give the same edges
+ */
+struct GraphSpec
+{
+    GraphFamily family;
+    std::uint64_t vertices;   // n (Gnp, Gnm, Complete, Eulerian)
+    std::uint64_t edges;      // m (Gnm, Rmat, Eulerian)
+    double probability;       // p (Gnp)
+    int scale;                // log2(n) (Rmat)
+    double a, b, c;           // Quadrant probabilities (Rmat); d = 1 - a - b - c
+    std::uint64_t x, y, z;    // Side lengths (Grid)
+    bool openTrail;           // Eulerian: drop the closing edge, leaving a trail between two odd vertices
+    int maxWeight;            // Weights uniform in 1..maxWeight; 0 for an unweighted graph (weight 1)
+    std::uint64_t seed;
+
+    GraphSpec()
+        : family(GraphFamily::Gnm), vertices(0), edges(0), probability(0.0), scale(0), a(0.57), b(0.19),
+          c(0.19), x(0), y(0), z(1), openTrail(false), maxWeight(0), seed(1) {}
+};
+
+/**
+ * @brief Receives the edges of a generator in batches
+ * @return false to stop the generator (e.g. after a write error)
+ */
+using EdgeBatchSink = std::function<bool(const Edge *edges, std::size_t count)>;
+
+/**
+ * @brief Check a spec, printing what is wrong on stderr
+ * @return true if the spec describes a valid graph with at most 2^31 - 1 vertices
+ */
+bool validate_spec(const GraphSpec &spec);
+
+/**
+ * @brief Number of vertices of the graph described by a spec
+ */
+std::uint64_t generated_vertices(const GraphSpec &spec);
+
+/**
+ * @brief Number of edges of the graph described by a spec
+ * For G(n, p) the count is random: the generator is run once without output to count them.
+ */
+std::uint64_t generated_edges(const GraphSpec &spec);
+
+/**
+ * @brief Generate the edges of a graph, streaming them to a sink in fixed-size batches
+ *
+ * Memory use does not depend on the number of edges, so graphs far larger than memory can
+ * be written to disk. G(n, m) uses Vitter's sequential sampling (Method D) over the
+ * n(n - 1) / 2 pairs and G(n, p) skips between edges with geometric jumps, so both run in
+ * O(n + m) without storing the edges. Every edge has u != v.
+ * @param spec The graph to generate (see validate_spec)
+ * @param sink Receives the edges
+ * @return false if the spec is invalid or the sink asked to stop
+ */
+bool generate_graph(const GraphSpec &spec, const EdgeBatchSink &sink);
+
+/**
+ * @brief Generate a graph in memory
+ * @param spec The graph to generate
+ * @param graph Receives the graph (weighted if spec.maxWeight > 0)
+ * @return false if the spec is invalid
+ */
+bool make_graph(const GraphSpec &spec, Graph &graph);
+
+/**
+ * @brief Parse a family name: gnp, gnm, rmat, grid, complete or eulerian
+ * @return false if the name is unknown
+ */
+bool parse_graph_family(const std::string &name, GraphFamily &family);
+
+#endif // GRAPH_GENERATORS_HPP
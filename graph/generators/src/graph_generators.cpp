@@ -0,0 +1,546 @@
+#include "graph_generators.hpp"
+#include <climits>
+#include <cmath>
+#include <iostream>
+#include <vector>
+
+namespace
+{
+    const std::size_t BATCH_SIZE = std::size_t(1) << 16;
+    const std::uint64_t WEIGHT_STREAM = 0x9e3779b97f4a7c15ULL; // Semente dos pesos: seed ^ WEIGHT_STREAM
+
+    /**
+     * @brief Random source of a generator: xoshiro256** (seeded through splitmix64) plus doubles in (0, 1)
+     * Several times faster than mt19937_64, which matters at billions of draws (R-MAT draws
+     * one number per level of every edge).
+     */
+    class Random
+    {
+    public:
+        explicit Random(std::uint64_t seed)
+        {
+            for (std::uint64_t &word : state)
+            {
+                seed += 0x9e3779b97f4a7c15ULL;
+                std::uint64_t z = seed;
+                z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ULL;
+                z = (z ^ (z >> 27)) * 0x94d049bb133111ebULL;
+                word = z ^ (z >> 31);
+            }
+        }
+
+        std::uint64_t next()
+        {
+            std::uint64_t result = rotl(state[1] * 5, 7) * 9;
+            std::uint64_t t = state[1] << 17;
+            state[2] ^= state[0];
+            state[3] ^= state[1];
+            state[1] ^= state[2];
+            state[0] ^= state[3];
+            state[2] ^= t;
+            state[3] = rotl(state[3], 45);
+            return result;
+        }
+
+        // (0, 1): nunca 0, para poder tirar log
+        double open01() { return ((next() >> 11) + 0.5) * (1.0 / 9007199254740992.0); }
+
+        // Uniforme em [0, bound), sem vies (rejeicao de Lemire)
+        std::uint64_t below(std::uint64_t bound)
+        {
+            unsigned __int128 product = static_cast<unsigned __int128>(next()) * bound;
+            std::uint64_t low = static_cast<std::uint64_t>(product);
+            if (low < bound)
+            {
+                std::uint64_t threshold = (0 - bound) % bound;
+                while (low < threshold)
+                {
+                    product = static_cast<unsigned __int128>(next()) * bound;
+                    low = static_cast<std::uint64_t>(product);
+                }
+            }
+            return static_cast<std::uint64_t>(product >> 64);
+        }
+
+    private:
+        static std::uint64_t rotl(std::uint64_t x, int k) { return (x << k) | (x >> (64 - k)); }
+
+        std::uint64_t state[4];
+    };
+
+    /**
+     * @brief Collects edges into a fixed-size batch, drawing the weights from their own stream
+     */
+    class Batcher
+    {
+    public:
+        Batcher(const GraphSpec &spec, const EdgeBatchSink &sink)
+            : sink(sink), weights(spec.seed ^ WEIGHT_STREAM), maxWeight(spec.maxWeight), stopped(false)
+        {
+            batch.reserve(BATCH_SIZE);
+        }
+
+        void add(std::uint64_t u, std::uint64_t v)
+        {
+            int weight = maxWeight > 0 ? static_cast<int>(weights.below(static_cast<std::uint64_t>(maxWeight))) + 1 : 1;
+            batch.emplace_back(static_cast<int>(u), static_cast<int>(v), weight);
+            if (batch.size() == BATCH_SIZE)
+                flush();
+        }
+
+        bool finish()
+        {
+            flush();
+            return !stopped;
+        }
+
+        bool isStopped() const { return stopped; }
+
+    private:
+        void flush()
+        {
+            if (!batch.empty() && !stopped && !sink(batch.data(), batch.size()))
+                stopped = true;
+            batch.clear();
+        }
+
+        const EdgeBatchSink &sink;
+        Random weights;
+        int maxWeight;
+        bool stopped;
+        std::vector<Edge> batch;
+    };
+
+    /**
+     * @brief Turns increasing pair indices (row-major over u < v) back into pairs, in O(n + m) overall
+     */
+    class PairDecoder
+    {
+    public:
+        explicit PairDecoder(std::uint64_t n) : n(n), u(1), rowStart(0) {}
+
+        void decode(std::uint64_t index, std::uint64_t &first, std::uint64_t &second)
+        {
+            while (index >= rowStart + (n - u))
+            {
+                rowStart += n - u;
+                ++u;
+            }
+            first = u;
+            second = u + 1 + (index - rowStart);
+        }
+
+    private:
+        std::uint64_t n;
+        std::uint64_t u;        // Linha atual
+        std::uint64_t rowStart; // Indice do par (u, u + 1)
+    };
+
+    std::uint64_t pair_count(std::uint64_t n)
+    {
+        return n < 2 ? 0 : n * (n - 1) / 2;
+    }
+
+    /**
+     * @brief Vitter's Method A: choose k of the indices [base, base + N) in increasing order, O(N)
+     */
+    template <typename Emit>
+    void vitter_a(Random &random, std::uint64_t k, std::uint64_t N, std::uint64_t current, Emit emit)
+    {
+        double top = static_cast<double>(N - k);
+        double Nreal = static_cast<double>(N);
+        while (k >= 2)
+        {
+            double V = random.open01();
+            std::uint64_t S = 0;
+            double quot = top / Nreal;
+            while (quot > V)
+            {
+                ++S;
+                top -= 1.0;
+                Nreal -= 1.0;
+                quot = quot * top / Nreal;
+            }
+            current += S;
+            emit(current++);
+            Nreal -= 1.0;
+            --k;
+        }
+        if (k == 1)
+        {
+            std::uint64_t S = static_cast<std::uint64_t>(std::floor(std::round(Nreal) * random.open01()));
+            emit(current + S);
+        }
+    }
+
+    /**
+     * @brief Vitter's Method D: choose k of the indices [0, N) in increasing order, O(k) expected
+     * Falls back to Method A once k is more than N / 13, where A is as fast and simpler.
+     */
+    template <typename Emit>
+    void vitter_d(Random &random, std::uint64_t k, std::uint64_t N, Emit emit)
+    {
+        if (k == 0)
+            return;
+        const double NEG_ALPHA_INV = -13.0;
+        std::uint64_t current = 0;
+        double nreal = static_cast<double>(k);
+        double ninv = 1.0 / nreal;
+        double Nreal = static_cast<double>(N);
+        double Vprime = std::exp(std::log(random.open01()) * ninv);
+        std::uint64_t qu1 = N - k + 1;
+        double qu1real = Nreal - nreal + 1.0;
+        double threshold = -NEG_ALPHA_INV * static_cast<double>(k);
+
+        while (k > 1 && threshold < Nreal)
+        {
+            double nmin1inv = 1.0 / (nreal - 1.0);
+            double X;
+            std::uint64_t S;
+            while (true)
+            {
+                // Candidato S para o salto, aceito ou rejeitado pelo teste de Vitter
+                while (true)
+                {
+                    X = Nreal * (1.0 - Vprime);
+                    S = static_cast<std::uint64_t>(X);
+                    if (S < qu1)
+                        break;
+                    Vprime = std::exp(std::log(random.open01()) * ninv);
+                }
+                double U = random.open01();
+                double negSreal = -static_cast<double>(S);
+                double y1 = std::exp(std::log(U * Nreal / qu1real) * nmin1inv);
+                Vprime = y1 * (1.0 - X / Nreal) * (qu1real / (negSreal + qu1real));
+                if (Vprime <= 1.0)
+                    break;
+
+                double y2 = 1.0;
+                double top = Nreal - 1.0;
+                double bottom;
+                std::uint64_t limit;
+                if (k - 1 > S)
+                {
+                    bottom = Nreal - nreal;
+                    limit = N - S;
+                }
+                else
+                {
+                    bottom = Nreal + negSreal - 1.0;
+                    limit = qu1;
+                }
+                for (std::uint64_t t = N - 1; t >= limit; --t)
+                {
+                    y2 = y2 * top / bottom;
+                    top -= 1.0;
+                    bottom -= 1.0;
+                }
+                if (Nreal / (Nreal - X) >= y1 * std::exp(std::log(y2) * nmin1inv))
+                {
+                    Vprime = std::exp(std::log(random.open01()) * nmin1inv);
+                    break;
+                }
+                Vprime = std::exp(std::log(random.open01()) * ninv);
+            }
+
+            current += S;
+            emit(current++);
+            N = N - S - 1;
+            Nreal = static_cast<double>(N);
+            --k;
+            nreal -= 1.0;
+            ninv = nmin1inv;
+            qu1 -= S;
+            qu1real -= static_cast<double>(S);
+            threshold += NEG_ALPHA_INV;
+        }
+
+        if (k > 1)
+        {
+            vitter_a(random, k, N, current, emit);
+        }
+        else
+        {
+            std::uint64_t S = static_cast<std::uint64_t>(Nreal * Vprime);
+            emit(current + S);
+        }
+    }
+
+    /**
+     * @brief G(n, p) by geometric jumps over the pair indices; calls emit(index) for each edge
+     */
+    template <typename Emit>
+    void gnp_indices(const GraphSpec &spec, Emit emit)
+    {
+        std::uint64_t N = pair_count(spec.vertices);
+        if (spec.probability <= 0.0)
+            return;
+        if (spec.probability >= 1.0)
+        {
+            for (std::uint64_t i = 0; i < N; ++i)
+                emit(i);
+            return;
+        }
+        Random random(spec.seed);
+        double logMiss = std::log1p(-spec.probability);
+        std::uint64_t index = 0;
+        while (true)
+        {
+            double jump = std::floor(std::log(random.open01()) / logMiss);
+            if (jump >= static_cast<double>(N - index))
+                return;
+            index += static_cast<std::uint64_t>(jump);
+            emit(index++);
+            if (index >= N)
+                return;
+        }
+    }
+
+    bool spec_error(const char *message)
+    {
+        std::cerr << "Error: " << message << std::endl;
+        return false;
+    }
+} // namespace
+
+bool validate_spec(const GraphSpec &spec)
+{
+    const std::uint64_t MAX_VERTICES = INT_MAX;
+    if (spec.maxWeight < 0)
+        return spec_error("the maximum weight must be 0 (unweighted) or positive");
+    switch (spec.family)
+    {
+    case GraphFamily::Gnp:
+        if (spec.vertices < 1 || spec.vertices > MAX_VERTICES)
+            return spec_error("G(n, p) needs 1 <= n <= 2^31 - 1");
+        if (!(spec.probability >= 0.0 && spec.probability <= 1.0))
+            return spec_error("G(n, p) needs 0 <= p <= 1");
+        return true;
+    case GraphFamily::Gnm:
+        if (spec.vertices < 1 || spec.vertices > MAX_VERTICES)
+            return spec_error("G(n, m) needs 1 <= n <= 2^31 - 1");
+        if (spec.edges > pair_count(spec.vertices))
+            return spec_error("G(n, m) needs m <= n(n - 1) / 2");
+        return true;
+    case GraphFamily::Rmat:
+        if (spec.scale < 1 || spec.scale > 30)
+            return spec_error("R-MAT needs 1 <= scale <= 30");
+        if (spec.a < 0 || spec.b < 0 || spec.c < 0 || spec.a + spec.b + spec.c > 1.0)
+            return spec_error("R-MAT needs a, b, c >= 0 and a + b + c <= 1");
+        if (spec.a + spec.b + spec.c == 0.0 || spec.b + spec.c + (1.0 - spec.a - spec.b - spec.c) == 0.0)
+            return spec_error("R-MAT probabilities only generate self-loops");
+        return true;
+    case GraphFamily::Grid:
+        if (spec.x < 1 || spec.y < 1 || spec.z < 1 || spec.x * spec.y > MAX_VERTICES ||
+            spec.x * spec.y * spec.z > MAX_VERTICES)
+            return spec_error("grids need sides >= 1 and at most 2^31 - 1 vertices");
+        return true;
+    case GraphFamily::Complete:
+        if (spec.vertices < 1 || spec.vertices > MAX_VERTICES)
+            return spec_error("K_n needs 1 <= n <= 2^31 - 1");
+        return true;
+    case GraphFamily::Eulerian:
+    {
+        if (spec.vertices < 3 || spec.vertices > MAX_VERTICES)
+            return spec_error("Eulerian graphs need 3 <= n <= 2^31 - 1");
+        // Passeio depois do ciclo: 0 arestas ou pelo menos 2 (um passeio fechado de 1 aresta seria um laco)
+        std::uint64_t total = spec.edges + (spec.openTrail ? 1 : 0);
+        if (total < spec.vertices || total - spec.vertices == 1)
+            return spec_error(spec.openTrail ? "open Eulerian trails need m = n - 1 or m >= n + 1"
+                                             : "closed Eulerian graphs need m = n or m >= n + 2");
+        return true;
+    }
+    }
+    return spec_error("unknown graph family");
+}
+
+std::uint64_t generated_vertices(const GraphSpec &spec)
+{
+    switch (spec.family)
+    {
+    case GraphFamily::Rmat:
+        return std::uint64_t(1) << spec.scale;
+    case GraphFamily::Grid:
+        return spec.x * spec.y * spec.z;
+    default:
+        return spec.vertices;
+    }
+}
+
+std::uint64_t generated_edges(const GraphSpec &spec)
+{
+    switch (spec.family)
+    {
+    case GraphFamily::Gnp:
+    {
+        std::uint64_t count = 0;
+        gnp_indices(spec, [&count](std::uint64_t) { ++count; });
+        return count;
+    }
+    case GraphFamily::Grid:
+        return (spec.x - 1) * spec.y * spec.z + spec.x * (spec.y - 1) * spec.z + spec.x * spec.y * (spec.z - 1);
+    case GraphFamily::Complete:
+        return pair_count(spec.vertices);
+    default:
+        return spec.edges;
+    }
+}
+
+bool generate_graph(const GraphSpec &spec, const EdgeBatchSink &sink)
+{
+    if (!validate_spec(spec))
+        return false;
+    Batcher out(spec, sink);
+    Random random(spec.seed);
+
+    switch (spec.family)
+    {
+    case GraphFamily::Gnp:
+    {
+        PairDecoder pairs(spec.vertices);
+        gnp_indices(spec, [&](std::uint64_t index) {
+            std::uint64_t u, v;
+            pairs.decode(index, u, v);
+            out.add(u, v);
+        });
+        break;
+    }
+    case GraphFamily::Gnm:
+    {
+        PairDecoder pairs(spec.vertices);
+        vitter_d(random, spec.edges, pair_count(spec.vertices), [&](std::uint64_t index) {
+            std::uint64_t u, v;
+            pairs.decode(index, u, v);
+            out.add(u, v);
+        });
+        break;
+    }
+    case GraphFamily::Rmat:
+    {
+        // Cada nivel usa 16 bits aleatorios (4 niveis por numero sorteado); limiares dos quadrantes em 1/65536
+        const std::uint64_t ONE = 1 << 16;
+        const std::uint64_t ta = static_cast<std::uint64_t>(spec.a * ONE);
+        const std::uint64_t tb = static_cast<std::uint64_t>((spec.a + spec.b) * ONE);
+        const std::uint64_t tc = static_cast<std::uint64_t>((spec.a + spec.b + spec.c) * ONE);
+        for (std::uint64_t i = 0; i < spec.edges && !out.isStopped(); ++i)
+        {
+            std::uint64_t u, v;
+            do
+            {
+                // Desce um nivel da matriz de adjacencia por bit, escolhendo um quadrante
+                u = v = 0;
+                std::uint64_t bits = 0;
+                for (int level = 0; level < spec.scale; ++level)
+                {
+                    if (level % 4 == 0)
+                        bits = random.next();
+                    std::uint64_t r = bits & (ONE - 1);
+                    bits >>= 16;
+                    // Sem desvios: a (0, 0), b (0, 1), c (1, 0), d (1, 1)
+                    u = (u << 1) | (r >= tb);
+                    v = (v << 1) | ((r >= ta) ^ (r >= tb) ^ (r >= tc));
+                }
+            } while (u == v);
+            out.add(u + 1, v + 1);
+        }
+        break;
+    }
+    case GraphFamily::Grid:
+    {
+        const std::uint64_t X = spec.x, Y = spec.y, Z = spec.z;
+        for (std::uint64_t k = 0; k < Z && !out.isStopped(); ++k)
+        {
+            for (std::uint64_t j = 0; j < Y; ++j)
+            {
+                for (std::uint64_t i = 0; i < X; ++i)
+                {
+                    std::uint64_t v = 1 + i + X * (j + Y * k);
+                    if (i + 1 < X)
+                        out.add(v, v + 1);
+                    if (j + 1 < Y)
+                        out.add(v, v + X);
+                    if (k + 1 < Z)
+                        out.add(v, v + X * Y);
+                }
+            }
+        }
+        break;
+    }
+    case GraphFamily::Complete:
+    {
+        for (std::uint64_t u = 1; u <= spec.vertices && !out.isStopped(); ++u)
+        {
+            for (std::uint64_t v = u + 1; v <= spec.vertices; ++v)
+                out.add(u, v);
+        }
+        break;
+    }
+    case GraphFamily::Eulerian:
+    {
+        // Ciclo 1-2-...-n-1 e depois um passeio fechado a partir de 1; na trilha aberta a
+        // ultima aresta fica de fora
+        const std::uint64_t n = spec.vertices;
+        const std::uint64_t walk = spec.edges + (spec.openTrail ? 1 : 0) - n;
+        const std::uint64_t total = n + walk;
+        std::uint64_t written = 0;
+        auto add = [&](std::uint64_t u, std::uint64_t v) {
+            if (written++ + 1 < total || !spec.openTrail)
+                out.add(u, v);
+        };
+        for (std::uint64_t v = 1; v < n; ++v)
+            add(v, v + 1);
+        add(n, 1);
+        std::uint64_t current = 1;
+        for (std::uint64_t step = 0; step < walk && !out.isStopped(); ++step)
+        {
+            std::uint64_t next = 1;
+            if (step + 1 < walk)
+            {
+                // O penultimo vertice nao pode ser 1, senao o passo de volta seria um laco
+                do
+                    next = random.below(n) + 1;
+                while (next == current || (step + 2 == walk && next == 1));
+            }
+            add(current, next);
+            current = next;
+        }
+        break;
+    }
+    }
+    return out.finish();
+}
+
+bool make_graph(const GraphSpec &spec, Graph &graph)
+{
+    if (!validate_spec(spec))
+        return false;
+    std::vector<Edge> edges;
+    edges.reserve(static_cast<std::size_t>(generated_edges(spec)));
+    generate_graph(spec, [&edges](const Edge *batch, std::size_t count) {
+        edges.insert(edges.end(), batch, batch + count);
+        return true;
+    });
+    graph = Graph(static_cast<int>(generated_vertices(spec)), spec.maxWeight > 0);
+    graph.addEdges(edges);
+    return true;
+}
+
+bool parse_graph_family(const std::string &name, GraphFamily &family)
+{
+    static const struct
+    {
+        const char *name;
+        GraphFamily family;
+    } FAMILIES[] = {{"gnp", GraphFamily::Gnp},           {"gnm", GraphFamily::Gnm},
+                    {"rmat", GraphFamily::Rmat},         {"grid", GraphFamily::Grid},
+                    {"complete", GraphFamily::Complete}, {"eulerian", GraphFamily::Eulerian}};
+    for (const auto &entry : FAMILIES)
+    {
+        if (name == entry.name)
+        {
+            family = entry.family;
+            return true;
+        }
+    }
+    return false;
+}
@@ -0,0 +1,196 @@
+#ifndef GRAPH_METRICS_HPP
+#define GRAPH_METRICS_HPP
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <mutex>
+#include <ostream>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+/*
+ * Instrumentacao por algoritmo. Com GRAPH_METRICS=0 (opcao GRAPH_METRICS do CMake desligada)
+ * as macros GRAPH_METRICS_SCOPE e GRAPH_METRICS_ADD viram ((void)0): nenhum contador, relogio
+ * ou argumento e avaliado, e os relatorios saem vazios com "enabled": false.
+ */
+#ifndef GRAPH_METRICS
+#define GRAPH_METRICS 1
+#endif
+
+namespace GraphMetrics
+{
+
+    /**
+     * @brief What the instrumented code counts
+     */
+    enum class Counter
+    {
+        VerticesTouched, // Vertices visited, labeled or scanned
+        EdgesTouched,    // Half-edges (adjacency entries) or edges examined
+        HeapOperations,  // Pushes, pops and decrease-keys on priority queues
+        UnionFindFinds,  // find calls on union-find structures (including those of unite)
+        GraphCopies,     // Graph copies (copy constructor)
+        Snapshots,       // CSR snapshots built from a Graph (Graph::freeze)
+        EdgesAdded,      // Edges inserted into a Graph
+        EdgesRemoved     // Edges deleted from a Graph (including those of removeVertex)
+    };
+
+    const int COUNTER_COUNT = 8;
+
+    /**
+     * @brief Name of a counter in the reports (snake_case, e.g. "edges_touched")
+     */
+    const char *counter_name(Counter counter);
+
+    /**
+     * @brief Accumulated cost of one instrumented algorithm
+     * Counters are inclusive: an algorithm that calls another one is charged for its work too.
+     */
+    struct AlgorithmMetrics
+    {
+        std::string name;
+        std::uint64_t calls;
+        double wallSeconds;
+        double cpuSeconds; // Process CPU time, so the worker threads of parallel algorithms count
+        std::uint64_t counters[COUNTER_COUNT];
+
+        AlgorithmMetrics() : calls(0), wallSeconds(0.0), cpuSeconds(0.0), counters() {}
+    };
+
+    /**
+     * @brief Values of every counter, e.g. the work a worker thread hands to the thread that started it
+     */
+    using CounterValues = std::array<std::uint64_t, COUNTER_COUNT>;
+
+    /**
+     * @brief Counters and finished scopes of one thread
+     * Only the owning thread writes the counters (load + store, no read-modify-write), any thread
+     * may read them. Scopes are recorded here under the thread's own lock, which only the reports
+     * also take. When the thread ends everything is folded into a process-wide total.
+     */
+    struct ThreadCounters
+    {
+        std::atomic<std::uint64_t> value[COUNTER_COUNT];
+        std::mutex lock;                                                // Guards algorithms
+        std::unordered_map<const char *, AlgorithmMetrics> algorithms; // Scopes closed on this thread
+
+        ThreadCounters();
+        ~ThreadCounters();
+    };
+
+    /**
+     * @brief Counters of the calling thread
+     */
+    inline ThreadCounters &thread_counters()
+    {
+        static thread_local ThreadCounters counters;
+        return counters;
+    }
+
+    /**
+     * @brief Add to a counter of the calling thread (a few instructions, no locking)
+     */
+    inline void add(Counter counter, std::uint64_t amount)
+    {
+        std::atomic<std::uint64_t> &slot = thread_counters().value[static_cast<int>(counter)];
+        slot.store(slot.load(std::memory_order_relaxed) + amount, std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief Move the counters of the calling thread out (a worker thread, when its work is done)
+     */
+    inline void hand_over(CounterValues &out)
+    {
+        ThreadCounters &counters = thread_counters();
+        for (int c = 0; c < COUNTER_COUNT; ++c)
+        {
+            out[c] = counters.value[c].load(std::memory_order_relaxed);
+            counters.value[c].store(0, std::memory_order_relaxed);
+        }
+    }
+
+    /**
+     * @brief Add counters handed over by a worker thread to those of the calling thread
+     */
+    inline void take_over(const CounterValues &in)
+    {
+        for (int c = 0; c < COUNTER_COUNT; ++c)
+            add(static_cast<Counter>(c), in[c]);
+    }
+
+    /**
+     * @brief Times an algorithm and charges it the counters added while it runs
+     *
+     * Only the counters of the calling thread are looked at, so algorithms running at the same
+     * time in different threads are not charged each other's work; parallel_for hands the work
+     * of its workers to the thread that called it. Opening and closing a scope takes no shared
+     * lock: the result goes to the thread's own table and is merged by the reports. A scope
+     * nested in a scope with the same name on the same thread (e.g. the Graph overload calling
+     * the CsrGraph one) records nothing, so each call is counted once.
+     */
+    class Scope
+    {
+    public:
+        explicit Scope(const char *name);
+        ~Scope();
+
+        Scope(const Scope &) = delete;
+        Scope &operator=(const Scope &) = delete;
+
+    private:
+        const char *name;
+        const Scope *parent;
+        bool nested;
+        CounterValues start;
+        std::chrono::steady_clock::time_point wallStart;
+        double cpuStart;
+    };
+
+    /**
+     * @brief Whether the library was built with instrumentation
+     */
+    bool enabled();
+
+    /**
+     * @brief Totals of every counter since the start (or the last reset), over all threads
+     */
+    AlgorithmMetrics totals();
+
+    /**
+     * @brief Metrics of every instrumented algorithm that ran, by name
+     */
+    std::vector<AlgorithmMetrics> report();
+
+    /**
+     * @brief Forget every metric recorded so far
+     * Should not be called while an instrumented algorithm is running.
+     */
+    void reset();
+
+    /**
+     * @brief Write the metrics as a JSON object: {"enabled", "totals", "algorithms": [...]}
+     */
+    void write_json(std::ostream &out);
+
+    /**
+     * @brief Write the metrics in the Prometheus text exposition format
+     * Per-algorithm series are labeled {algorithm="name"}; process totals have no label.
+     */
+    void write_prometheus(std::ostream &out);
+
+} // namespace GraphMetrics
+
+#if GRAPH_METRICS
+#define GRAPH_METRICS_CONCAT_(a, b) a##b
+#define GRAPH_METRICS_CONCAT(a, b) GRAPH_METRICS_CONCAT_(a, b)
+#define GRAPH_METRICS_SCOPE(name) ::GraphMetrics::Scope GRAPH_METRICS_CONCAT(graphMetricsScope, __LINE__)(name)
+#define GRAPH_METRICS_ADD(counter, amount) ::GraphMetrics::add(::GraphMetrics::Counter::counter, static_cast<std::uint64_t>(amount))
+#else
+#define GRAPH_METRICS_SCOPE(name) ((void)0)
+#define GRAPH_METRICS_ADD(counter, amount) ((void)0)
+#endif
+
+#endif // GRAPH_METRICS_HPP
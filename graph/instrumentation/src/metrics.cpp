@@ -0,0 +1,254 @@
+#include "metrics.hpp"
+#include <cstring>
+#include <ctime>
+#include <map>
+
+namespace GraphMetrics
+{
+    namespace
+    {
+        const char *const COUNTER_NAMES[COUNTER_COUNT] = {
+            "vertices_touched", "edges_touched", "heap_operations", "union_find_finds",
+            "graph_copies", "snapshots", "edges_added", "edges_removed"};
+
+        const char *const COUNTER_HELP[COUNTER_COUNT] = {
+            "Vertices visited, labeled or scanned",
+            "Half-edges or edges examined",
+            "Pushes, pops and decrease-keys on priority queues",
+            "Union-find find calls",
+            "Graph copies",
+            "CSR snapshots built from a Graph",
+            "Edges inserted into a Graph",
+            "Edges deleted from a Graph"};
+
+        struct Registry
+        {
+            std::mutex lock;
+            std::vector<ThreadCounters *> live;         // Contadores das threads vivas
+            std::uint64_t retired[COUNTER_COUNT] = {};  // Soma das threads que ja terminaram
+            std::uint64_t baseline[COUNTER_COUNT] = {}; // Totais no ultimo reset
+            std::map<std::string, AlgorithmMetrics> retiredAlgorithms; // Escopos das threads que ja terminaram
+        };
+
+        // Nunca destruido: threads podem terminar (e devolver contadores) depois dos estaticos
+        Registry &registry()
+        {
+            static Registry *instance = new Registry();
+            return *instance;
+        }
+
+        thread_local const Scope *innermost = nullptr; // Escopo aberto mais interno desta thread
+
+        // Chamar com registry().lock
+        void sum_counters(std::uint64_t (&sum)[COUNTER_COUNT])
+        {
+            Registry &r = registry();
+            for (int c = 0; c < COUNTER_COUNT; ++c)
+                sum[c] = r.retired[c];
+            for (const ThreadCounters *counters : r.live)
+            {
+                for (int c = 0; c < COUNTER_COUNT; ++c)
+                    sum[c] += counters->value[c].load(std::memory_order_relaxed);
+            }
+        }
+
+        void merge(std::map<std::string, AlgorithmMetrics> &into, const AlgorithmMetrics &metrics)
+        {
+            AlgorithmMetrics &total = into[metrics.name];
+            total.name = metrics.name;
+            total.calls += metrics.calls;
+            total.wallSeconds += metrics.wallSeconds;
+            total.cpuSeconds += metrics.cpuSeconds;
+            for (int c = 0; c < COUNTER_COUNT; ++c)
+                total.counters[c] += metrics.counters[c];
+        }
+
+        double cpu_seconds()
+        {
+            return static_cast<double>(std::clock()) / CLOCKS_PER_SEC;
+        }
+
+        void write_json_counters(std::ostream &out, const AlgorithmMetrics &metrics)
+        {
+            for (int c = 0; c < COUNTER_COUNT; ++c)
+                out << (c == 0 ? "" : ", ") << "\"" << COUNTER_NAMES[c] << "\": " << metrics.counters[c];
+        }
+    } // namespace
+
+    const char *counter_name(Counter counter)
+    {
+        return COUNTER_NAMES[static_cast<int>(counter)];
+    }
+
+    ThreadCounters::ThreadCounters()
+    {
+        for (int c = 0; c < COUNTER_COUNT; ++c)
+            value[c].store(0, std::memory_order_relaxed);
+        Registry &r = registry();
+        std::lock_guard<std::mutex> guard(r.lock);
+        r.live.push_back(this);
+    }
+
+    ThreadCounters::~ThreadCounters()
+    {
+        Registry &r = registry();
+        std::lock_guard<std::mutex> guard(r.lock);
+        for (int c = 0; c < COUNTER_COUNT; ++c)
+            r.retired[c] += value[c].load(std::memory_order_relaxed);
+        {
+            std::lock_guard<std::mutex> own(lock);
+            for (const auto &entry : algorithms)
+                merge(r.retiredAlgorithms, entry.second);
+        }
+        for (size_t i = 0; i < r.live.size(); ++i)
+        {
+            if (r.live[i] == this)
+            {
+                r.live[i] = r.live.back();
+                r.live.pop_back();
+                break;
+            }
+        }
+    }
+
+    Scope::Scope(const char *name) : name(name), parent(innermost), nested(false), start(), cpuStart(0.0)
+    {
+        for (const Scope *outer = parent; outer != nullptr; outer = outer->parent)
+        {
+            if (outer->name == name || std::strcmp(outer->name, name) == 0)
+            {
+                nested = true;
+                break;
+            }
+        }
+        innermost = this;
+        if (nested)
+            return;
+        // So os contadores desta thread: nenhuma trava compartilhada
+        ThreadCounters &counters = thread_counters();
+        for (int c = 0; c < COUNTER_COUNT; ++c)
+            start[c] = counters.value[c].load(std::memory_order_relaxed);
+        cpuStart = cpu_seconds();
+        wallStart = std::chrono::steady_clock::now();
+    }
+
+    Scope::~Scope()
+    {
+        innermost = parent;
+        if (nested)
+            return;
+        double wall = std::chrono::duration<double>(std::chrono::steady_clock::now() - wallStart).count();
+        double cpu = cpu_seconds() - cpuStart;
+
+        // A trava da propria thread so disputa com os relatorios
+        ThreadCounters &counters = thread_counters();
+        std::lock_guard<std::mutex> guard(counters.lock);
+        AlgorithmMetrics &metrics = counters.algorithms[name];
+        if (metrics.name.empty())
+            metrics.name = name;
+        metrics.calls++;
+        metrics.wallSeconds += wall;
+        metrics.cpuSeconds += cpu;
+        for (int c = 0; c < COUNTER_COUNT; ++c)
+            metrics.counters[c] += counters.value[c].load(std::memory_order_relaxed) - start[c];
+    }
+
+    bool enabled()
+    {
+        return GRAPH_METRICS != 0;
+    }
+
+    AlgorithmMetrics totals()
+    {
+        AlgorithmMetrics result;
+        result.name = "total";
+        Registry &r = registry();
+        std::lock_guard<std::mutex> guard(r.lock);
+        sum_counters(result.counters);
+        for (int c = 0; c < COUNTER_COUNT; ++c)
+            result.counters[c] -= r.baseline[c];
+        return result;
+    }
+
+    std::vector<AlgorithmMetrics> report()
+    {
+        Registry &r = registry();
+        std::lock_guard<std::mutex> guard(r.lock);
+        std::map<std::string, AlgorithmMetrics> merged = r.retiredAlgorithms;
+        for (ThreadCounters *counters : r.live)
+        {
+            std::lock_guard<std::mutex> own(counters->lock);
+            for (const auto &entry : counters->algorithms)
+                merge(merged, entry.second);
+        }
+        std::vector<AlgorithmMetrics> result;
+        for (const auto &entry : merged)
+            result.push_back(entry.second);
+        return result;
+    }
+
+    void reset()
+    {
+        Registry &r = registry();
+        std::lock_guard<std::mutex> guard(r.lock);
+        sum_counters(r.baseline);
+        r.retiredAlgorithms.clear();
+        for (ThreadCounters *counters : r.live)
+        {
+            std::lock_guard<std::mutex> own(counters->lock);
+            counters->algorithms.clear();
+        }
+    }
+
+    void write_json(std::ostream &out)
+    {
+        AlgorithmMetrics total = totals();
+        std::vector<AlgorithmMetrics> algorithms = report();
+        out << "{\n  \"enabled\": " << (enabled() ? "true" : "false") << ",\n  \"totals\": {";
+        write_json_counters(out, total);
+        out << "},\n  \"algorithms\": [";
+        for (size_t i = 0; i < algorithms.size(); ++i)
+        {
+            const AlgorithmMetrics &metrics = algorithms[i];
+            out << (i == 0 ? "\n" : ",\n") << "    {\"name\": \"" << metrics.name << "\", \"calls\": " << metrics.calls
+                << ", \"wall_seconds\": " << metrics.wallSeconds << ", \"cpu_seconds\": " << metrics.cpuSeconds << ", ";
+            write_json_counters(out, metrics);
+            out << "}";
+        }
+        out << (algorithms.empty() ? "]\n}\n" : "\n  ]\n}\n");
+    }
+
+    void write_prometheus(std::ostream &out)
+    {
+        AlgorithmMetrics total = totals();
+        std::vector<AlgorithmMetrics> algorithms = report();
+
+        out << "# HELP graph_metrics_enabled Whether the library was built with instrumentation\n"
+            << "# TYPE graph_metrics_enabled gauge\n"
+            << "graph_metrics_enabled " << (enabled() ? 1 : 0) << "\n";
+        for (int c = 0; c < COUNTER_COUNT; ++c)
+        {
+            out << "# HELP graph_" << COUNTER_NAMES[c] << "_total " << COUNTER_HELP[c] << "\n"
+                << "# TYPE graph_" << COUNTER_NAMES[c] << "_total counter\n"
+                << "graph_" << COUNTER_NAMES[c] << "_total " << total.counters[c] << "\n";
+        }
+
+        auto series = [&](const char *metric, const char *type, const char *help, auto value) {
+            out << "# HELP graph_algorithm_" << metric << " " << help << "\n"
+                << "# TYPE graph_algorithm_" << metric << " " << type << "\n";
+            for (const AlgorithmMetrics &metrics : algorithms)
+                out << "graph_algorithm_" << metric << "{algorithm=\"" << metrics.name << "\"} " << value(metrics) << "\n";
+        };
+        series("calls_total", "counter", "Calls of each algorithm", [](const AlgorithmMetrics &m) { return m.calls; });
+        series("wall_seconds_total", "counter", "Wall-clock time spent in each algorithm",
+               [](const AlgorithmMetrics &m) { return m.wallSeconds; });
+        series("cpu_seconds_total", "counter", "Process CPU time spent in each algorithm",
+               [](const AlgorithmMetrics &m) { return m.cpuSeconds; });
+        for (int c = 0; c < COUNTER_COUNT; ++c)
+        {
+            std::string metric = std::string(COUNTER_NAMES[c]) + "_total";
+            series(metric.c_str(), "counter", COUNTER_HELP[c], [c](const AlgorithmMetrics &m) { return m.counters[c]; });
+        }
+    }
+
+} // namespace GraphMetrics
@@ -0,0 +1,74 @@
+#ifndef BINARY_GRAPH_HPP
+#define BINARY_GRAPH_HPP
+
+#include <cstdint>
+#include <string>
+#include "csr_graph.hpp"
+#include "graph.hpp"
+
+/**
+ * @brief Header of the binary graph format (little-endian, 128 bytes)
+ *
+ * The header is followed by the CSR arrays of the graph, each one starting at a
+ * 64-byte aligned position given in the header:
+ * offsets (uint64 x n + 2), targets (int32 x 2m), weights (int32 x 2m, only for weighted
+ * graphs) and edge ids (int32 x 2m). The arrays have exactly the layout of CsrGraph, so the
+ * file can be mapped and used without any parsing.
+ */
+struct BinaryGraphHeader
+{
+    char magic[8];              // "GRAPHCSR"
+    std::uint32_t version;      // BINARY_GRAPH_VERSION
+    std::uint32_t flags;        // BINARY_GRAPH_WEIGHTED
+    std::uint64_t numVertices;  // n
+    std::uint64_t numEdges;     // m
+    std::uint32_t minDegree;    // Minimum degree of any vertex
+    std::uint32_t maxDegree;    // Maximum degree of any vertex
+    std::uint64_t offsetsStart; // Byte position of each array in the file
+    std::uint64_t targetsStart;
+    std::uint64_t weightsStart; // 0 for unweighted graphs
+    std::uint64_t edgeIdsStart;
+    std::uint64_t fileSize;     // Total size, used to detect truncated files
+    std::uint8_t reserved[48];
+};
+
+const std::uint32_t BINARY_GRAPH_VERSION = 1;
+const std::uint32_t BINARY_GRAPH_WEIGHTED = 1u << 0;
+
+/**
+ * @brief Check whether a file starts with the magic bytes of the binary format
+ * @param path Path of the file
+ * @return true if the file is a binary graph
+ */
+bool is_binary_graph(const std::string &path);
+
+/**
+ * @brief Write a graph in the binary format
+ * @param graph The graph to write
+ * @param path Path of the output file
+ * @return true on success, false (with a message on stderr) on failure
+ */
+bool save_binary(const Graph &graph, const std::string &path);
+
+/**
+ * @brief Write a CSR snapshot in the binary format
+ * @param graph The snapshot to write
+ * @param path Path of the output file
+ * @return true on success, false (with a message on stderr) on failure
+ */
+bool save_binary(const CsrGraph &graph, const std::string &path);
+
+/**
+ * @brief Open a binary graph as a read-only CSR snapshot
+ *
+ * The whole file is memory-mapped and the snapshot points straight into the mapping;
+ * nothing is copied or allocated per vertex, and the mapping lives as long as any copy of
+ * the snapshot. Opening is O(1): only the header (sizes, section bounds, all checked against
+ * overflow and the file size) and the first and last offsets are validated.
+ * @param path Path of the file
+ * @param graph Receives the snapshot
+ * @return true on success, false (with a message on stderr) on failure
+ */
+bool open_binary(const std::string &path, CsrGraph &graph);
+
+#endif // BINARY_GRAPH_HPP
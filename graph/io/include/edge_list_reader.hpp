@@ -0,0 +1,79 @@
+#ifndef EDGE_LIST_READER_HPP
+#define EDGE_LIST_READER_HPP
+
+#include <cstdint>
+#include <string>
+#include <vector>
+#include "graph.hpp"
+#include "myDS.hpp"
+
+using namespace MyDataStructures;
+
+/**
+ * @brief First line of an edge list file: "n m" or, in the Dijkstra inputs, "n m s t"
+ */
+struct EdgeListHeader
+{
+    int numVertices; // n
+    int numEdges;    // m
+    int source;      // s, or -1 if the header has only two numbers
+    int target;      // t, or -1 if the header has only two numbers
+
+    EdgeListHeader() : numVertices(0), numEdges(0), source(-1), target(-1) {}
+};
+
+/**
+ * @brief Throughput of a read
+ */
+struct EdgeListReadStats
+{
+    std::uint64_t bytes; // Bytes scanned
+    double seconds;      // Wall time spent mapping and parsing
+
+    EdgeListReadStats() : bytes(0), seconds(0.0) {}
+
+    /**
+     * @brief Parse throughput in MB/s (10^6 bytes per second)
+     */
+    double megabytesPerSecond() const { return seconds > 0.0 ? bytes / seconds / 1e6 : 0.0; }
+};
+
+/**
+ * @brief Reads an edge list file ("n m [s t]" followed by m lines "u v [w]")
+ *
+ * The file is memory-mapped in fixed-size windows, so files larger than the available
+ * memory are scanned with bounded address space, and integers are parsed by hand without
+ * locale handling. Only the first m edge lines are read. Binary edge lists (see
+ * edge_list_writer.hpp) are recognized by their magic bytes and read the same way.
+ * @param path Path of the file
+ * @param weighted Whether the third number of each edge line is its weight (1 otherwise)
+ * @param header Receives the first line of the file
+ * @param edges Receives the m edges, in file order
+ * @param stats Optional throughput report
+ * @return true on success, false (with a message on stderr) on failure
+ */
+bool read_edge_list(const std::string &path, bool weighted, EdgeListHeader &header,
+                    std::vector<Edge> &edges, EdgeListReadStats *stats = nullptr);
+
+/**
+ * @brief Reads an edge list file straight into a graph, adding all edges in one bulk pass
+ * @param path Path of the file
+ * @param weighted Whether the graph is weighted
+ * @param graph Receives the graph
+ * @param stats Optional throughput report
+ * @return true on success, false (with a message on stderr) on failure
+ */
+bool load_edge_list(const std::string &path, bool weighted, Graph &graph, EdgeListReadStats *stats = nullptr);
+
+/**
+ * @brief Reads an edge list file straight into a CSR snapshot, without building adjacency lists
+ * For read-only queries: the result equals load_edge_list into a Graph followed by freeze().
+ * @param path Path of the file
+ * @param weighted Whether the graph is weighted
+ * @param graph Receives the snapshot
+ * @param stats Optional throughput report
+ * @return true on success, false (with a message on stderr) on failure
+ */
+bool load_edge_list(const std::string &path, bool weighted, CsrGraph &graph, EdgeListReadStats *stats = nullptr);
+
+#endif // EDGE_LIST_READER_HPP
@@ -0,0 +1,103 @@
+#ifndef EDGE_LIST_WRITER_HPP
+#define EDGE_LIST_WRITER_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <string>
+#include <vector>
+#include "myDS.hpp"
+
+using namespace MyDataStructures;
+
+/**
+ * @brief Header of the binary edge list format (little-endian, 64 bytes)
+ *
+ * The header is followed by m records of int32 "u v" (8 bytes) or, for weighted graphs,
+ * "u v w" (12 bytes), in the order they were written. Unlike the CSR binary format it can be
+ * written as a stream, one edge at a time, with no knowledge of the rest of the graph.
+ */
+struct BinaryEdgeListHeader
+{
+    char magic[8];              // "GRAPHEDG"
+    std::uint32_t version;      // BINARY_EDGE_LIST_VERSION
+    std::uint32_t flags;        // BINARY_EDGE_LIST_WEIGHTED
+    std::uint64_t numVertices;  // n
+    std::uint64_t numEdges;     // m
+    std::uint8_t reserved[32];
+};
+
+const std::uint32_t BINARY_EDGE_LIST_VERSION = 1;
+const std::uint32_t BINARY_EDGE_LIST_WEIGHTED = 1u << 0;
+
+/**
+ * @brief Output format of EdgeListWriter
+ */
+enum class EdgeListFormat
+{
+    Text,   // "n m" followed by m lines "u v [w]", the format of data/input
+    Binary  // BinaryEdgeListHeader followed by m fixed-size records
+};
+
+/**
+ * @brief Check whether a file starts with the magic bytes of the binary edge list format
+ * @param path Path of the file
+ * @return true if the file is a binary edge list
+ */
+bool is_binary_edge_list(const std::string &path);
+
+/**
+ * @brief Streams an edge list to a file (or stdout) through a fixed-size buffer
+ *
+ * The number of edges goes in the header, so it must be known before the first edge;
+ * close() checks that exactly that many edges were written. Memory use does not depend on
+ * the size of the graph.
+ */
+class EdgeListWriter
+{
+public:
+    EdgeListWriter();
+    ~EdgeListWriter();
+
+    EdgeListWriter(const EdgeListWriter &) = delete;
+    EdgeListWriter &operator=(const EdgeListWriter &) = delete;
+
+    /**
+     * @brief Create the output and write the header
+     * @param path Path of the output file, or "-" for stdout
+     * @param format Text or binary
+     * @param vertices Number of vertices (n)
+     * @param edges Number of edges that will be written (m)
+     * @param weighted Whether to write the weights
+     * @return true on success, false (with a message on stderr) on failure
+     */
+    bool open(const std::string &path, EdgeListFormat format, std::uint64_t vertices, std::uint64_t edges, bool weighted);
+
+    /**
+     * @brief Append edges
+     * @return true on success, false (with a message on stderr) on failure
+     */
+    bool write(const Edge *edges, std::size_t count);
+
+    /**
+     * @brief Flush the buffer and close the output
+     * @return true if everything was written and the edge count matches the header
+     */
+    bool close();
+
+private:
+    bool flush();
+
+    std::FILE *file;
+    bool ownsFile;
+    EdgeListFormat format;
+    bool weighted;
+    bool failed;
+    std::uint64_t expectedEdges;
+    std::uint64_t writtenEdges;
+    std::string path;
+    std::vector<char> buffer;
+    std::size_t used;
+};
+
+#endif // EDGE_LIST_WRITER_HPP
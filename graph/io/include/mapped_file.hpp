@@ -0,0 +1,76 @@
+#ifndef MAPPED_FILE_HPP
+#define MAPPED_FILE_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <string>
+#include <vector>
+
+#if defined(__unix__) || defined(__APPLE__)
+#define GRAPH_HAS_MMAP 1
+#else
+#define GRAPH_HAS_MMAP 0
+#endif
+
+/**
+ * @brief Read-only view of a file through one memory-mapped window at a time
+ *
+ * On POSIX systems the window is an mmap of the requested range. Elsewhere the range is
+ * read into an internal buffer, which keeps the same interface at the cost of a copy.
+ */
+class MappedFile
+{
+public:
+    MappedFile();
+    ~MappedFile();
+
+    MappedFile(const MappedFile &) = delete;
+    MappedFile &operator=(const MappedFile &) = delete;
+
+    /**
+     * @brief Open a file for reading
+     * @param path Path of the file
+     * @return true on success
+     */
+    bool open(const std::string &path);
+
+    /**
+     * @brief Unmap the current window and close the file
+     */
+    void close();
+
+    /**
+     * @brief Size of the open file in bytes
+     */
+    std::uint64_t size() const { return fileSize; }
+
+    /**
+     * @brief Map a range of the file, replacing the previous window
+     * @param offset Start of the range; must be a multiple of granularity()
+     * @param length Length of the range (clipped to the end of the file)
+     * @param sequential Hint that the range will be read once, front to back
+     * @return Pointer to the first byte of the range, or nullptr on failure
+     */
+    const char *map(std::uint64_t offset, std::size_t length, bool sequential = true);
+
+    /**
+     * @brief Alignment required for window offsets
+     */
+    static std::size_t granularity();
+
+private:
+    void unmap();
+
+#if GRAPH_HAS_MMAP
+    int fd;
+    void *window;
+    std::size_t windowLength;
+#else
+    std::FILE *file;
+    std::vector<char> buffer;
+#endif
+    std::uint64_t fileSize;
+};
+
+#endif // MAPPED_FILE_HPP
@@ -0,0 +1,214 @@
+#include "binary_graph.hpp"
+#include "mapped_file.hpp"
+#include <climits>
+#include <cstdio>
+#include <cstring>
+#include <iostream>
+#include <memory>
+
+static_assert(sizeof(BinaryGraphHeader) == 128, "binary graph header must be 128 bytes");
+static_assert(sizeof(int) == 4, "the binary graph format stores 32-bit vertex ids");
+
+namespace
+{
+    const char MAGIC[8] = {'G', 'R', 'A', 'P', 'H', 'C', 'S', 'R'};
+    const std::uint64_t ALIGNMENT = 64;
+
+    bool isLittleEndian()
+    {
+        const std::uint32_t probe = 1;
+        unsigned char first;
+        std::memcpy(&first, &probe, 1);
+        return first == 1;
+    }
+
+    std::uint64_t alignUp(std::uint64_t position)
+    {
+        return (position + ALIGNMENT - 1) / ALIGNMENT * ALIGNMENT;
+    }
+
+    /**
+     * @brief Check that [start, start + bytes) ends at or before limit, without overflowing
+     */
+    bool fitsBefore(std::uint64_t start, std::uint64_t bytes, std::uint64_t limit)
+    {
+        return start <= limit && bytes <= limit - start;
+    }
+
+    /**
+     * @brief Write an array at a given position, padding the gap before it with zeros
+     */
+    bool writeAt(std::FILE *file, std::uint64_t &position, std::uint64_t start, const void *data, std::uint64_t bytes)
+    {
+        static const char zeros[ALIGNMENT] = {};
+        if (std::fwrite(zeros, 1, start - position, file) != start - position)
+            return false;
+        position = start;
+        if (bytes > 0 && std::fwrite(data, 1, bytes, file) != bytes)
+            return false;
+        position += bytes;
+        return true;
+    }
+} // namespace
+
+bool is_binary_graph(const std::string &path)
+{
+    std::FILE *file = std::fopen(path.c_str(), "rb");
+    if (file == nullptr)
+        return false;
+    char magic[sizeof(MAGIC)];
+    bool matches = std::fread(magic, 1, sizeof(magic), file) == sizeof(magic) &&
+                   std::memcmp(magic, MAGIC, sizeof(MAGIC)) == 0;
+    std::fclose(file);
+    return matches;
+}
+
+bool save_binary(const Graph &graph, const std::string &path)
+{
+    return save_binary(graph.freeze(), path);
+}
+
+bool save_binary(const CsrGraph &graph, const std::string &path)
+{
+    if (!isLittleEndian())
+    {
+        std::cerr << "Error: the binary graph format is only supported on little-endian machines" << std::endl;
+        return false;
+    }
+
+    if (graph.isDirected())
+    {
+        std::cerr << "Error: the binary graph format only stores undirected graphs" << std::endl;
+        return false;
+    }
+
+    const std::uint64_t n = static_cast<std::uint64_t>(graph.getOrder());
+    const std::uint64_t halfEdges = 2 * static_cast<std::uint64_t>(graph.getSize());
+
+    BinaryGraphHeader header;
+    std::memset(&header, 0, sizeof(header));
+    std::memcpy(header.magic, MAGIC, sizeof(MAGIC));
+    header.version = BINARY_GRAPH_VERSION;
+    header.flags = graph.getIsWeighted() ? BINARY_GRAPH_WEIGHTED : 0;
+    header.numVertices = n;
+    header.numEdges = static_cast<std::uint64_t>(graph.getSize());
+    header.minDegree = static_cast<std::uint32_t>(graph.getMinDegree());
+    header.maxDegree = static_cast<std::uint32_t>(graph.getMaxDegree());
+    header.offsetsStart = alignUp(sizeof(header));
+    header.targetsStart = alignUp(header.offsetsStart + (n + 2) * sizeof(std::uint64_t));
+    std::uint64_t next = alignUp(header.targetsStart + halfEdges * sizeof(int));
+    if (graph.getIsWeighted())
+    {
+        header.weightsStart = next;
+        next = alignUp(next + halfEdges * sizeof(int));
+    }
+    header.edgeIdsStart = next;
+    header.fileSize = header.edgeIdsStart + halfEdges * sizeof(int);
+
+    std::FILE *file = std::fopen(path.c_str(), "wb");
+    if (file == nullptr)
+    {
+        std::cerr << "Error: Could not create " << path << std::endl;
+        return false;
+    }
+
+    std::uint64_t position = 0;
+    bool ok = writeAt(file, position, 0, &header, sizeof(header)) &&
+              writeAt(file, position, header.offsetsStart, graph.offsetsData(), (n + 2) * sizeof(std::uint64_t)) &&
+              writeAt(file, position, header.targetsStart, graph.targetsData(), halfEdges * sizeof(int)) &&
+              (!graph.getIsWeighted() ||
+               writeAt(file, position, header.weightsStart, graph.weightsData(), halfEdges * sizeof(int))) &&
+              writeAt(file, position, header.edgeIdsStart, graph.edgeIdsData(), halfEdges * sizeof(int));
+    ok = (std::fclose(file) == 0) && ok;
+    if (!ok)
+        std::cerr << "Error: Could not write " << path << std::endl;
+    return ok;
+}
+
+bool open_binary(const std::string &path, CsrGraph &graph)
+{
+    if (!isLittleEndian())
+    {
+        std::cerr << "Error: the binary graph format is only supported on little-endian machines" << std::endl;
+        return false;
+    }
+
+    auto file = std::make_shared<MappedFile>();
+    if (!file->open(path))
+    {
+        std::cerr << "Error: Could not open " << path << std::endl;
+        return false;
+    }
+    if (file->size() < sizeof(BinaryGraphHeader))
+    {
+        std::cerr << "Error: " << path << " is too small to be a binary graph" << std::endl;
+        return false;
+    }
+
+    const char *base = file->map(0, static_cast<std::size_t>(file->size()), false);
+    if (base == nullptr)
+    {
+        std::cerr << "Error: Could not map " << path << std::endl;
+        return false;
+    }
+
+    BinaryGraphHeader header;
+    std::memcpy(&header, base, sizeof(header));
+    if (std::memcmp(header.magic, MAGIC, sizeof(MAGIC)) != 0)
+    {
+        std::cerr << "Error: " << path << " is not a binary graph" << std::endl;
+        return false;
+    }
+    if (header.version != BINARY_GRAPH_VERSION)
+    {
+        std::cerr << "Error: " << path << " has binary graph version " << header.version
+                  << ", expected " << BINARY_GRAPH_VERSION << std::endl;
+        return false;
+    }
+
+    // n e m cabem em int, entao nenhum tamanho abaixo passa de 2^35 bytes
+    if (header.numVertices > INT_MAX || header.numEdges > INT_MAX)
+    {
+        std::cerr << "Error: " << path << " is too large to be loaded (" << header.numVertices << " vertices, "
+                  << header.numEdges << " edges)" << std::endl;
+        return false;
+    }
+
+    // Cada vetor comeca depois do anterior e termina antes do proximo (e do fim do arquivo),
+    // conferido antes de ler qualquer posicao deles
+    const bool weighted = (header.flags & BINARY_GRAPH_WEIGHTED) != 0;
+    const std::uint64_t halfEdges = 2 * header.numEdges;
+    const std::uint64_t offsetsBytes = (header.numVertices + 2) * sizeof(std::uint64_t);
+    const std::uint64_t arrayBytes = halfEdges * sizeof(int);
+    const std::uint64_t size = file->size();
+    const std::uint64_t targetsEnd = weighted ? header.weightsStart : header.edgeIdsStart;
+    if (header.fileSize != size ||
+        header.offsetsStart % ALIGNMENT != 0 || header.targetsStart % ALIGNMENT != 0 ||
+        header.weightsStart % ALIGNMENT != 0 || header.edgeIdsStart % ALIGNMENT != 0 ||
+        header.offsetsStart < sizeof(BinaryGraphHeader) ||
+        !fitsBefore(header.offsetsStart, offsetsBytes, header.targetsStart) ||
+        !fitsBefore(header.targetsStart, arrayBytes, targetsEnd) ||
+        (weighted && !fitsBefore(header.weightsStart, arrayBytes, header.edgeIdsStart)) ||
+        !fitsBefore(header.edgeIdsStart, arrayBytes, size))
+    {
+        std::cerr << "Error: " << path << " is truncated or corrupted" << std::endl;
+        return false;
+    }
+
+    const std::uint64_t *offsets = reinterpret_cast<const std::uint64_t *>(base + header.offsetsStart);
+    if (offsets[0] != 0 || offsets[header.numVertices + 1] != halfEdges)
+    {
+        std::cerr << "Error: " << path << " is truncated or corrupted" << std::endl;
+        return false;
+    }
+
+    // O snapshot aponta direto para o mapeamento, que vive enquanto houver copias dele
+    graph = CsrGraph(static_cast<int>(header.numVertices), static_cast<int>(header.numEdges),
+                     static_cast<int>(header.minDegree), static_cast<int>(header.maxDegree),
+                     offsets,
+                     reinterpret_cast<const int *>(base + header.targetsStart),
+                     weighted ? reinterpret_cast<const int *>(base + header.weightsStart) : nullptr,
+                     reinterpret_cast<const int *>(base + header.edgeIdsStart),
+                     file);
+    return true;
+}
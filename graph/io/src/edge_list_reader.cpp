@@ -0,0 +1,317 @@
+#include "edge_list_reader.hpp"
+#include "edge_list_writer.hpp"
+#include "mapped_file.hpp"
+#include <algorithm>
+#include <chrono>
+#include <climits>
+#include <cstring>
+#include <iostream>
+
+namespace
+{
+    // Janela de 64 MiB: multiplo de qualquer tamanho de pagina usual
+    const std::size_t WINDOW_SIZE = std::size_t(64) << 20;
+
+    /**
+     * @brief Line-oriented integer scanner that keeps its state between windows
+     *
+     * Numbers may be split across two windows, so the partial value, the numbers already
+     * seen on the current line and the line number live here instead of on the stack.
+     */
+    class EdgeListScanner
+    {
+    public:
+        EdgeListScanner(bool weighted, EdgeListHeader &header, std::vector<Edge> &edges, std::uint64_t fileSize)
+            : weighted(weighted), header(header), edges(edges), fileSize(fileSize), value(0), negative(false),
+              inNumber(false), tokenCount(0), line(1), headerDone(false), failed(false) {}
+
+        /**
+         * @brief Scan a chunk of the file
+         * @return false once all m edges were read or an error was found
+         */
+        bool feed(const char *p, const char *end)
+        {
+            for (; p != end; ++p)
+            {
+                const unsigned char c = static_cast<unsigned char>(*p);
+                const unsigned digit = c - '0';
+                if (digit < 10)
+                {
+                    // Satura logo acima do maior modulo aceito: endNumber rejeita o numero
+                    if (value <= INT_LIMIT)
+                        value = value * 10 + digit;
+                    inNumber = true;
+                }
+                else if (c == ' ' || c == '\t' || c == '\r')
+                {
+                    if (!endNumber())
+                        return false;
+                }
+                else if (c == '\n')
+                {
+                    if (!endNumber() || !endLine())
+                        return false;
+                    ++line;
+                }
+                else if (c == '-' && !inNumber && !negative)
+                {
+                    negative = true;
+                }
+                else
+                {
+                    return fail("unexpected character");
+                }
+            }
+            return !failed;
+        }
+
+        /**
+         * @brief Flush the last line of a file that does not end with a newline
+         * @return true if the file held a header and m edges
+         */
+        bool finish()
+        {
+            if (failed)
+                return false;
+            if (endNumber())
+                endLine();
+            if (failed)
+                return false;
+            if (!headerDone)
+                return fail("missing header");
+            if (!isComplete())
+                return fail("fewer edges than announced in the header");
+            return true;
+        }
+
+        bool isComplete() const
+        {
+            return headerDone && static_cast<int>(edges.size()) == header.numEdges;
+        }
+
+    private:
+        // Maior modulo de um int (o de INT_MIN)
+        static constexpr unsigned long long INT_LIMIT = static_cast<unsigned long long>(INT_MAX) + 1;
+
+        bool endNumber()
+        {
+            if (!inNumber)
+            {
+                negative = false;
+                return true;
+            }
+            if (value > (negative ? INT_LIMIT : static_cast<unsigned long long>(INT_MAX)))
+                return fail("number out of the int range");
+            if (tokenCount < 4)
+                tokens[tokenCount] = negative ? -static_cast<long long>(value) : static_cast<long long>(value);
+            ++tokenCount;
+            value = 0;
+            negative = false;
+            inNumber = false;
+            return true;
+        }
+
+        bool endLine()
+        {
+            int count = tokenCount;
+            tokenCount = 0;
+            if (count == 0)
+                return true; // linha em branco
+
+            if (!headerDone)
+            {
+                if (count != 2 && count != 4)
+                    return fail("header must be \"n m\" or \"n m s t\"");
+                if (tokens[0] < 0 || tokens[1] < 0)
+                    return fail("negative number of vertices or edges");
+                header.numVertices = static_cast<int>(tokens[0]);
+                header.numEdges = static_cast<int>(tokens[1]);
+                if (count == 4)
+                {
+                    header.source = static_cast<int>(tokens[2]);
+                    header.target = static_cast<int>(tokens[3]);
+                }
+                headerDone = true;
+                // Cada linha de aresta tem ao menos 4 bytes ("u v\n"): um m exagerado nao reserva alem do arquivo
+                edges.reserve(static_cast<std::size_t>(std::min<std::uint64_t>(header.numEdges, fileSize / 4)));
+                return header.numEdges > 0;
+            }
+
+            if (count < 2 || count > 3)
+                return fail("edge lines must be \"u v\" or \"u v w\"");
+            int weight = (weighted && count == 3) ? static_cast<int>(tokens[2]) : 1;
+            edges.emplace_back(static_cast<int>(tokens[0]), static_cast<int>(tokens[1]), weight);
+            return !isComplete();
+        }
+
+        bool fail(const char *message)
+        {
+            std::cerr << "Error: line " << line << ": " << message << std::endl;
+            failed = true;
+            return false;
+        }
+
+        bool weighted;
+        EdgeListHeader &header;
+        std::vector<Edge> &edges;
+        std::uint64_t fileSize;
+        unsigned long long value;
+        bool negative;
+        bool inNumber;
+        int tokenCount;
+        long long tokens[4];
+        std::uint64_t line;
+        bool headerDone;
+        bool failed;
+    };
+
+    /**
+     * @brief Read the records of a binary edge list (see BinaryEdgeListHeader)
+     * @return Number of bytes scanned, or 0 on failure
+     */
+    std::uint64_t readBinaryEdgeList(MappedFile &file, const std::string &path, bool weighted,
+                                     EdgeListHeader &header, std::vector<Edge> &edges)
+    {
+        BinaryEdgeListHeader binary;
+        const char *first = file.map(0, sizeof(binary));
+        if (first == nullptr || file.size() < sizeof(binary))
+        {
+            std::cerr << "Error: " << path << " is too small to be a binary edge list" << std::endl;
+            return 0;
+        }
+        std::memcpy(&binary, first, sizeof(binary));
+        if (binary.version != BINARY_EDGE_LIST_VERSION)
+        {
+            std::cerr << "Error: " << path << " has binary edge list version " << binary.version
+                      << ", expected " << BINARY_EDGE_LIST_VERSION << std::endl;
+            return 0;
+        }
+        if (binary.numVertices > INT_MAX || binary.numEdges > INT_MAX)
+        {
+            std::cerr << "Error: " << path << " is too large to be loaded (" << binary.numVertices << " vertices, "
+                      << binary.numEdges << " edges)" << std::endl;
+            return 0;
+        }
+        const bool fileWeighted = (binary.flags & BINARY_EDGE_LIST_WEIGHTED) != 0;
+        const std::size_t recordSize = (fileWeighted ? 3 : 2) * sizeof(int);
+        if (file.size() != sizeof(binary) + binary.numEdges * recordSize)
+        {
+            std::cerr << "Error: " << path << " is truncated or corrupted" << std::endl;
+            return 0;
+        }
+
+        header.numVertices = static_cast<int>(binary.numVertices);
+        header.numEdges = static_cast<int>(binary.numEdges);
+        edges.reserve(header.numEdges);
+
+        // Registros podem ficar divididos entre duas janelas: os bytes da ponta vao para "pending"
+        char pending[3 * sizeof(int)];
+        std::size_t pendingBytes = 0;
+        std::uint64_t offset = 0;
+        while (offset < file.size())
+        {
+            const char *window = file.map(offset, WINDOW_SIZE);
+            if (window == nullptr)
+            {
+                std::cerr << "Error: Could not map " << path << std::endl;
+                return 0;
+            }
+            std::size_t length = static_cast<std::size_t>(std::min<std::uint64_t>(WINDOW_SIZE, file.size() - offset));
+            std::size_t position = offset == 0 ? sizeof(binary) : 0;
+            while (position < length)
+            {
+                std::size_t take = std::min(recordSize - pendingBytes, length - position);
+                std::memcpy(pending + pendingBytes, window + position, take);
+                pendingBytes += take;
+                position += take;
+                if (pendingBytes == recordSize)
+                {
+                    int record[3] = {0, 0, 1};
+                    std::memcpy(record, pending, recordSize);
+                    edges.emplace_back(record[0], record[1], (weighted && fileWeighted) ? record[2] : 1);
+                    pendingBytes = 0;
+                }
+            }
+            offset += length;
+        }
+        return offset;
+    }
+} // namespace
+
+bool read_edge_list(const std::string &path, bool weighted, EdgeListHeader &header,
+                    std::vector<Edge> &edges, EdgeListReadStats *stats)
+{
+    auto start = std::chrono::steady_clock::now();
+
+    MappedFile file;
+    if (!file.open(path))
+    {
+        std::cerr << "Error: Could not open " << path << std::endl;
+        return false;
+    }
+
+    header = EdgeListHeader();
+    edges.clear();
+
+    const char *magic = file.size() >= 8 ? file.map(0, 8) : nullptr;
+    if (magic != nullptr && std::memcmp(magic, "GRAPHEDG", 8) == 0)
+    {
+        std::uint64_t bytes = readBinaryEdgeList(file, path, weighted, header, edges);
+        if (stats != nullptr)
+        {
+            stats->bytes = bytes;
+            stats->seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+        }
+        return bytes > 0;
+    }
+
+    EdgeListScanner scanner(weighted, header, edges, file.size());
+
+    // Percorre o arquivo janela a janela ate ler as m arestas
+    std::uint64_t offset = 0;
+    while (offset < file.size())
+    {
+        const char *window = file.map(offset, WINDOW_SIZE);
+        if (window == nullptr)
+        {
+            std::cerr << "Error: Could not map " << path << std::endl;
+            return false;
+        }
+        std::size_t length = static_cast<std::size_t>(std::min<std::uint64_t>(WINDOW_SIZE, file.size() - offset));
+        bool more = scanner.feed(window, window + length);
+        offset += length;
+        if (!more)
+            break;
+    }
+    bool ok = scanner.isComplete() || scanner.finish();
+
+    if (stats != nullptr)
+    {
+        stats->bytes = offset;
+        stats->seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    }
+    return ok;
+}
+
+bool load_edge_list(const std::string &path, bool weighted, Graph &graph, EdgeListReadStats *stats)
+{
+    EdgeListHeader header;
+    std::vector<Edge> edges;
+    if (!read_edge_list(path, weighted, header, edges, stats))
+        return false;
+
+    graph = Graph(header.numVertices, weighted);
+    graph.addEdges(edges);
+    return true;
+}
+
+bool load_edge_list(const std::string &path, bool weighted, CsrGraph &graph, EdgeListReadStats *stats)
+{
+    EdgeListHeader header;
+    std::vector<Edge> edges;
+    if (!read_edge_list(path, weighted, header, edges, stats))
+        return false;
+
+    graph = CsrGraph::undirected(header.numVertices, edges, weighted);
+    return true;
+}
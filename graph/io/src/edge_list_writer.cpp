@@ -0,0 +1,182 @@
+#include "edge_list_writer.hpp"
+#include <cstring>
+#include <iostream>
+
+static_assert(sizeof(BinaryEdgeListHeader) == 64, "binary edge list header must be 64 bytes");
+
+namespace
+{
+    const char MAGIC[8] = {'G', 'R', 'A', 'P', 'H', 'E', 'D', 'G'};
+    const std::size_t BUFFER_SIZE = std::size_t(1) << 20;
+    const std::size_t MAX_LINE = 40; // "-2147483648 -2147483648 -2147483648\n"
+
+    bool isLittleEndian()
+    {
+        const std::uint32_t probe = 1;
+        unsigned char first;
+        std::memcpy(&first, &probe, 1);
+        return first == 1;
+    }
+
+    // Escreve um inteiro em decimal e devolve o fim; mais rapido que printf para bilhoes de linhas
+    char *appendInt(char *out, long long value)
+    {
+        if (value < 0)
+        {
+            *out++ = '-';
+            value = -value;
+        }
+        char digits[20];
+        int count = 0;
+        do
+        {
+            digits[count++] = static_cast<char>('0' + value % 10);
+            value /= 10;
+        } while (value != 0);
+        while (count > 0)
+            *out++ = digits[--count];
+        return out;
+    }
+} // namespace
+
+bool is_binary_edge_list(const std::string &path)
+{
+    std::FILE *file = std::fopen(path.c_str(), "rb");
+    if (file == nullptr)
+        return false;
+    char magic[sizeof(MAGIC)];
+    bool matches = std::fread(magic, 1, sizeof(magic), file) == sizeof(magic) &&
+                   std::memcmp(magic, MAGIC, sizeof(MAGIC)) == 0;
+    std::fclose(file);
+    return matches;
+}
+
+EdgeListWriter::EdgeListWriter()
+    : file(nullptr), ownsFile(false), format(EdgeListFormat::Text), weighted(false), failed(false),
+      expectedEdges(0), writtenEdges(0), used(0) {}
+
+EdgeListWriter::~EdgeListWriter()
+{
+    if (file != nullptr)
+        close();
+}
+
+bool EdgeListWriter::open(const std::string &path, EdgeListFormat format, std::uint64_t vertices, std::uint64_t edges, bool weighted)
+{
+    if (format == EdgeListFormat::Binary && !isLittleEndian())
+    {
+        std::cerr << "Error: the binary edge list format is only supported on little-endian machines" << std::endl;
+        return false;
+    }
+
+    this->path = path;
+    this->format = format;
+    this->weighted = weighted;
+    failed = false;
+    expectedEdges = edges;
+    writtenEdges = 0;
+    used = 0;
+    buffer.resize(BUFFER_SIZE);
+
+    ownsFile = path != "-";
+    file = ownsFile ? std::fopen(path.c_str(), format == EdgeListFormat::Binary ? "wb" : "w") : stdout;
+    if (file == nullptr)
+    {
+        std::cerr << "Error: Could not create " << path << std::endl;
+        return false;
+    }
+
+    if (format == EdgeListFormat::Binary)
+    {
+        BinaryEdgeListHeader header;
+        std::memset(&header, 0, sizeof(header));
+        std::memcpy(header.magic, MAGIC, sizeof(MAGIC));
+        header.version = BINARY_EDGE_LIST_VERSION;
+        header.flags = weighted ? BINARY_EDGE_LIST_WEIGHTED : 0;
+        header.numVertices = vertices;
+        header.numEdges = edges;
+        std::memcpy(buffer.data(), &header, sizeof(header));
+        used = sizeof(header);
+    }
+    else
+    {
+        char *out = buffer.data();
+        out = appendInt(out, static_cast<long long>(vertices));
+        *out++ = ' ';
+        out = appendInt(out, static_cast<long long>(edges));
+        *out++ = '\n';
+        used = static_cast<std::size_t>(out - buffer.data());
+    }
+    return true;
+}
+
+bool EdgeListWriter::write(const Edge *edges, std::size_t count)
+{
+    if (file == nullptr || failed)
+        return false;
+    writtenEdges += count;
+
+    if (format == EdgeListFormat::Binary)
+    {
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            if (used + 3 * sizeof(int) > buffer.size() && !flush())
+                return false;
+            int record[3] = {edges[i].u, edges[i].v, edges[i].weight};
+            std::size_t bytes = (weighted ? 3 : 2) * sizeof(int);
+            std::memcpy(buffer.data() + used, record, bytes);
+            used += bytes;
+        }
+        return true;
+    }
+
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        if (used + MAX_LINE > buffer.size() && !flush())
+            return false;
+        char *out = buffer.data() + used;
+        out = appendInt(out, edges[i].u);
+        *out++ = ' ';
+        out = appendInt(out, edges[i].v);
+        if (weighted)
+        {
+            *out++ = ' ';
+            out = appendInt(out, edges[i].weight);
+        }
+        *out++ = '\n';
+        used = static_cast<std::size_t>(out - buffer.data());
+    }
+    return true;
+}
+
+bool EdgeListWriter::flush()
+{
+    if (used > 0 && std::fwrite(buffer.data(), 1, used, file) != used)
+    {
+        std::cerr << "Error: Could not write " << path << std::endl;
+        failed = true;
+        return false;
+    }
+    used = 0;
+    return true;
+}
+
+bool EdgeListWriter::close()
+{
+    if (file == nullptr)
+        return false;
+    bool ok = !failed && flush();
+    if (ownsFile)
+        ok = (std::fclose(file) == 0) && ok;
+    else
+        ok = (std::fflush(file) == 0) && ok;
+    file = nullptr;
+    buffer.clear();
+    buffer.shrink_to_fit();
+    if (ok && writtenEdges != expectedEdges)
+    {
+        std::cerr << "Error: " << path << ": wrote " << writtenEdges << " edges, header says " << expectedEdges << std::endl;
+        ok = false;
+    }
+    return ok;
+}
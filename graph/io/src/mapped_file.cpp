@@ -0,0 +1,135 @@
+#include "mapped_file.hpp"
+
+#if GRAPH_HAS_MMAP
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+MappedFile::MappedFile() : fd(-1), window(nullptr), windowLength(0), fileSize(0) {}
+
+MappedFile::~MappedFile()
+{
+    close();
+}
+
+bool MappedFile::open(const std::string &path)
+{
+    close();
+    fd = ::open(path.c_str(), O_RDONLY);
+    if (fd < 0)
+        return false;
+    struct stat info;
+    if (fstat(fd, &info) != 0)
+    {
+        close();
+        return false;
+    }
+    fileSize = static_cast<std::uint64_t>(info.st_size);
+    return true;
+}
+
+void MappedFile::close()
+{
+    unmap();
+    if (fd >= 0)
+        ::close(fd);
+    fd = -1;
+    fileSize = 0;
+}
+
+void MappedFile::unmap()
+{
+    if (window != nullptr)
+        munmap(window, windowLength);
+    window = nullptr;
+    windowLength = 0;
+}
+
+const char *MappedFile::map(std::uint64_t offset, std::size_t length, bool sequential)
+{
+    unmap();
+    if (fd < 0 || offset >= fileSize || length == 0)
+        return nullptr;
+    if (length > fileSize - offset)
+        length = static_cast<std::size_t>(fileSize - offset);
+
+    void *address = mmap(nullptr, length, PROT_READ, MAP_PRIVATE, fd, static_cast<off_t>(offset));
+    if (address == MAP_FAILED)
+        return nullptr;
+    // Leitura sequencial: o kernel pode antecipar as proximas paginas e descartar as lidas
+    if (sequential)
+        madvise(address, length, MADV_SEQUENTIAL);
+    window = address;
+    windowLength = length;
+    return static_cast<const char *>(window);
+}
+
+std::size_t MappedFile::granularity()
+{
+    return static_cast<std::size_t>(sysconf(_SC_PAGESIZE));
+}
+
+#else
+
+MappedFile::MappedFile() : file(nullptr), fileSize(0) {}
+
+MappedFile::~MappedFile()
+{
+    close();
+}
+
+bool MappedFile::open(const std::string &path)
+{
+    close();
+    file = std::fopen(path.c_str(), "rb");
+    if (file == nullptr)
+        return false;
+    if (_fseeki64(file, 0, SEEK_END) != 0)
+    {
+        close();
+        return false;
+    }
+    fileSize = static_cast<std::uint64_t>(_ftelli64(file));
+    return true;
+}
+
+void MappedFile::close()
+{
+    unmap();
+    if (file != nullptr)
+        std::fclose(file);
+    file = nullptr;
+    fileSize = 0;
+}
+
+void MappedFile::unmap()
+{
+    buffer.clear();
+}
+
+const char *MappedFile::map(std::uint64_t offset, std::size_t length, bool sequential)
+{
+    unmap();
+    if (file == nullptr || offset >= fileSize || length == 0)
+        return nullptr;
+    if (length > fileSize - offset)
+        length = static_cast<std::size_t>(fileSize - offset);
+
+    (void)sequential;
+    buffer.resize(length);
+    if (_fseeki64(file, static_cast<long long>(offset), SEEK_SET) != 0 ||
+        std::fread(buffer.data(), 1, length, file) != length)
+    {
+        buffer.clear();
+        return nullptr;
+    }
+    return buffer.data();
+}
+
+std::size_t MappedFile::granularity()
+{
+    return 1;
+}
+
+#endif
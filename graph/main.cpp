@@ -1,126 +1,510 @@
-#include <iostream>
+#include <cstdlib>
 #include <fstream>
+#include <iostream>
+#include <string>
 #include "data_structure/include/graph.hpp"
 #include "algorithms/include/connected.hpp"
 #include "algorithms/include/minimum_spanning_tree.hpp"
 #include "algorithms/include/trails.hpp"
+#include "algorithms/include/parallel.hpp"
+#include "io/include/edge_list_reader.hpp"
+#include "io/include/binary_graph.hpp"
+#include "instrumentation/include/metrics.hpp"
+#include "server/include/query_server.hpp"
 using namespace std;
 
-int main(int argc, char const *argv[])
+namespace
 {
-    // Open the input file
-    if (argc < 3)
+    /**
+     * @brief Analyses the program can run; Report runs all of them, as the original program did
+     */
+    enum class Command
     {
-        std::cerr << "Usage: " << argv[0] << " <input_file_path>" << " <weigthed?_true_or_false>" << std::endl;
-        return 1;
-    }
-    std::ifstream file(argv[1]);
-    if (!file.is_open())
+        Report,     // Adjacency list, connectivity, k-connectivity 1..6, forest, MSTs and Euler
+        Print,      // Adjacency list and degrees
+        Components, // Connected components (and the size of one of them with --vertex)
+        KConn,      // k-edge and/or k-vertex connectivity for one k
+        Forest,     // Whether the graph has no cycles
+        Mst,        // Minimum spanning forest with one algorithm
+        Euler,      // Eulerian trail
+        Serve       // Answer queries from stdin or a Unix socket until end of input or a signal
+    };
+
+    struct Options
     {
-        std::cerr << "Error: Could not open " << argv[1] << std::endl;
-        return 1;
+        Command command = Command::Report;
+        string path;
+        bool weighted = false;
+        bool quiet = false;                // So os resultados, sem rotulos nem estatisticas de leitura
+        int vertex = 0;                    // components --vertex (0: nenhum)
+        int k = 0;                         // kconn --k
+        bool edgeConnectivity = true;      // kconn --type=edge|vertex|both
+        bool vertexConnectivity = true;
+        string mstAlgorithm = "kruskal";
+        EulerianTrailAlgorithm eulerAlgorithm = EulerianTrailAlgorithm::Hierholzer;
+        string metricsFormat, metricsOutput;
+        string socketPath;                 // serve --socket (vazio: stdin/stdout)
+        QueryProtocol protocol = QueryProtocol::Text;
+    };
+
+    void usage(const char *program)
+    {
+        cerr << "Usage: " << program << " [command] <input_file_path> [weigthed?_true_or_false] [options]\n"
+             << "Commands (default: report, every analysis as before):\n"
+             << "  report      adjacency list, connectivity, k-connectivity for k = 1..6, forest, MSTs, Euler\n"
+             << "  print       adjacency list\n"
+             << "  components  [--vertex=V]\n"
+             << "  kconn       --k=K [--type=edge|vertex|both]\n"
+             << "  forest\n"
+             << "  mst         [--algo=kruskal|prim|filter-kruskal|boruvka]\n"
+             << "  euler       [--algo=hierholzer|fleury]\n"
+             << "  serve       [--socket=path] [--protocol=text|binary]\n"
+             << "Options: --quiet --threads=N --euler=hierholzer|fleury --metrics=json|prometheus --metrics-output=file"
+             << endl;
     }
-    bool isWeighted = (string(argv[2]) == "true") ? true : false;
 
-    // Read number of vertices and edges
-    int numVertices, numEdges;
-    file >> numVertices >> numEdges;
-    // Create graph with the specified number of vertices and set it as weighted
-    Graph graph(numVertices, isWeighted);
+    bool parse_command(const string &name, Command &command)
+    {
+        static const pair<const char *, Command> COMMANDS[] = {
+            {"report", Command::Report}, {"print", Command::Print}, {"components", Command::Components},
+            {"kconn", Command::KConn},   {"forest", Command::Forest}, {"mst", Command::Mst},
+            {"euler", Command::Euler},   {"serve", Command::Serve}};
+        for (const auto &entry : COMMANDS)
+        {
+            if (name == entry.first)
+            {
+                command = entry.second;
+                return true;
+            }
+        }
+        return false;
+    }
 
-    // // Read vertices (though we don't need to do anything with them since they're already created)
-    // for (int i = 0; i < numVertices; i++)
-    // {
-    //     int vertex;
-    //     file >> vertex;
-    // }
+    bool parse_option(const string &argument, const char *name, string &value)
+    {
+        size_t length = char_traits<char>::length(name);
+        if (argument.compare(0, length, name) != 0 || argument.size() <= length || argument[length] != '=')
+            return false;
+        value = argument.substr(length + 1);
+        return true;
+    }
 
-    // Read and add edges with weights
-    if (isWeighted)
+    bool parse_euler_algorithm(const string &name, EulerianTrailAlgorithm &algorithm)
     {
-        for (int i = 0; i < numEdges; i++)
+        if (name == "hierholzer")
+            algorithm = EulerianTrailAlgorithm::Hierholzer;
+        else if (name == "fleury")
+            algorithm = EulerianTrailAlgorithm::Fleury;
+        else
         {
-            int u, v, weight;
-            file >> u >> v >> weight;
-            graph.addEdge(u, v, weight);
+            cerr << "Error: unknown Eulerian trail algorithm " << name << endl;
+            return false;
         }
+        return true;
     }
-    else
+
+    bool parse_arguments(int argc, char const *argv[], Options &options)
     {
-        for (int i = 0; i < numEdges; i++)
+        int next = 1;
+        if (next < argc && parse_command(argv[next], options.command))
+            ++next;
+
+        // Opcoes podem vir antes ou depois do arquivo: o primeiro argumento que nao e opcao e o arquivo
+        for (int i = next; i < argc; ++i)
         {
-            int u, v;
-            file >> u >> v;
-            graph.addEdge(u, v);
+            string argument = argv[i], value;
+            if (options.path.empty() && argument[0] != '-')
+                options.path = argument;
+            else if (argument == "true" || argument == "false")
+                options.weighted = argument == "true";
+            else if (argument == "--quiet")
+                options.quiet = true;
+            else if (parse_option(argument, "--threads", value))
+            {
+                int threads = atoi(value.c_str());
+                if (threads < 1)
+                {
+                    cerr << "Error: invalid thread count " << value << endl;
+                    return false;
+                }
+                set_thread_count(threads);
+            }
+            else if (parse_option(argument, "--euler", value))
+            {
+                if (!parse_euler_algorithm(value, options.eulerAlgorithm))
+                    return false;
+            }
+            else if (parse_option(argument, "--algo", value))
+            {
+                if (options.command == Command::Euler)
+                {
+                    if (!parse_euler_algorithm(value, options.eulerAlgorithm))
+                        return false;
+                }
+                else if (value == "kruskal" || value == "prim" || value == "filter-kruskal" || value == "boruvka")
+                    options.mstAlgorithm = value;
+                else
+                {
+                    cerr << "Error: unknown MST algorithm " << value << endl;
+                    return false;
+                }
+            }
+            else if (parse_option(argument, "--vertex", value))
+                options.vertex = atoi(value.c_str());
+            else if (parse_option(argument, "--k", value))
+                options.k = atoi(value.c_str());
+            else if (parse_option(argument, "--type", value))
+            {
+                if (value != "edge" && value != "vertex" && value != "both")
+                {
+                    cerr << "Error: unknown connectivity type " << value << endl;
+                    return false;
+                }
+                options.edgeConnectivity = value != "vertex";
+                options.vertexConnectivity = value != "edge";
+            }
+            else if (parse_option(argument, "--metrics", value))
+            {
+                if (value != "json" && value != "prometheus")
+                {
+                    cerr << "Error: unknown metrics format " << value << endl;
+                    return false;
+                }
+                options.metricsFormat = value;
+            }
+            else if (parse_option(argument, "--metrics-output", value))
+                options.metricsOutput = value;
+            else if (parse_option(argument, "--socket", value))
+                options.socketPath = value;
+            else if (parse_option(argument, "--protocol", value))
+            {
+                if (value != "text" && value != "binary")
+                {
+                    cerr << "Error: unknown protocol " << value << endl;
+                    return false;
+                }
+                options.protocol = value == "binary" ? QueryProtocol::Binary : QueryProtocol::Text;
+            }
+            else
+            {
+                cerr << "Error: unknown option " << argument << endl;
+                usage(argv[0]);
+                return false;
+            }
         }
-    }
 
-    // Close the file
-    file.close();
+        if (options.path.empty())
+        {
+            usage(argv[0]);
+            return false;
+        }
 
-    // Print the graph
-    // cout << "Graph Structure:" << endl;
-    graph.printGraph();
+        if (options.command == Command::KConn && options.k < 1)
+        {
+            cerr << "Error: kconn needs --k=K with K >= 1" << endl;
+            return false;
+        }
+        return true;
+    }
 
-    if (is_connected(graph))
+    /**
+     * @brief Load the input: the adjacency lists only if the command needs them, else only the snapshot
+     * Read-only analyses run on the CSR snapshot, built straight from the file (or mapped, for
+     * binary graphs), so they never pay for the linked lists nor for a freeze.
+     */
+    bool load_input(const Options &options, bool needsGraph, Graph &graph, CsrGraph &snapshot)
     {
-        cout << "O grafo e conexo" << endl;
+        if (is_binary_graph(options.path))
+        {
+            // Arquivo binario: o peso vem do cabecalho, sem reler o texto
+            if (!open_binary(options.path, snapshot))
+                return false;
+            if (needsGraph)
+                graph = Graph(snapshot);
+            return true;
+        }
+
+        EdgeListReadStats readStats;
+        if (needsGraph)
+        {
+            // Read the header and all edges, then build the graph in one bulk pass
+            if (!load_edge_list(options.path, options.weighted, graph, &readStats))
+                return false;
+            snapshot = graph.freeze();
+        }
+        else if (!load_edge_list(options.path, options.weighted, snapshot, &readStats))
+        {
+            return false;
+        }
+        if (!options.quiet)
+        {
+            cerr << "Leitura: " << readStats.bytes << " bytes em " << readStats.seconds << " s ("
+                 << readStats.megabytesPerSecond() << " MB/s)" << endl;
+        }
+        return true;
     }
-    else
+
+    const char *yes_no(bool answer)
     {
-        cout << "O grafo nao e conexo" << endl;
+        return answer ? "SIM" : "NAO";
     }
 
-    cout << "O numero de componentes conexos e: " << connected_component_amount(graph) << endl;
-    cout << "O numero de vertices no componente conexo de 6 e: " << vertices_amount_in_connected_component(graph, 6) << endl;
-    cout << "O grafo e " << 1 << "-aresta-conexo?: " << (is_k_edge_connected(graph, 1) ? "SIM" : "NAO") << endl;
-    cout << "O grafo e " << 2 << "-aresta-conexo?: " << (is_k_edge_connected(graph, 2) ? "SIM" : "NAO") << endl;
-    cout << "O grafo e " << 3 << "-aresta-conexo?: " << (is_k_edge_connected(graph, 3) ? "SIM" : "NAO") << endl;
-    cout << "O grafo e " << 4 << "-aresta-conexo?: " << (is_k_edge_connected(graph, 4) ? "SIM" : "NAO") << endl;
-    cout << "O grafo e " << 5 << "-aresta-conexo?: " << (is_k_edge_connected(graph, 5) ? "SIM" : "NAO") << endl;
-    cout << "O grafo e " << 6 << "-aresta-conexo?: " << (is_k_edge_connected(graph, 6) ? "SIM" : "NAO") << endl;
-    cout << "-------------------------------------------------------" << endl;
-    cout << "O grafo e " << 1 << "-vertice-conexo?: " << (is_k_vertex_connected(graph, 1) ? "SIM" : "NAO") << endl;
-    cout << "O grafo e " << 2 << "-vertice-conexo?: " << (is_k_vertex_connected(graph, 2) ? "SIM" : "NAO") << endl;
-    cout << "O grafo e " << 3 << "-vertice-conexo?: " << (is_k_vertex_connected(graph, 3) ? "SIM" : "NAO") << endl;
-    cout << "O grafo e " << 4 << "-vertice-conexo?: " << (is_k_vertex_connected(graph, 4) ? "SIM" : "NAO") << endl;
-    cout << "O grafo e " << 5 << "-vertice-conexo?: " << (is_k_vertex_connected(graph, 5) ? "SIM" : "NAO") << endl;
-    cout << "O grafo e " << 6 << "-vertice-conexo?: " << (is_k_vertex_connected(graph, 6) ? "SIM" : "NAO") << endl;
-    cout << "O grafo e uma floresta?: " << (is_forest(graph) ? "SIM" : "NAO") << endl;
+    void print_trail(const vector<Edge> &trail, bool quiet)
+    {
+        for (const Edge &edge : trail)
+        {
+            if (quiet)
+                cout << edge.u << " " << edge.v << "\n";
+            else
+                cout << edge.u << " -> " << edge.v << "\n";
+        }
+        cout << flush;
+    }
 
-    if (isWeighted)
+    void run_report(const Options &options, const Graph &graph, const CsrGraph &snapshot)
     {
-        vector<Edge> mst_union_find = kruskal_mst(graph);
-        print_mst(mst_union_find);
-        cout << "-------------------------------------------------------" << endl;
+        graph.printGraph();
 
-        vector<Edge> mst_prim_naive = prim_mst_naive(graph);
-        print_mst(mst_prim_naive);
+        // Uma rotulacao serve para as consultas de conexidade e para a floresta
+        ComponentLabels components = component_labels(snapshot);
+        if (is_connected(components))
+        {
+            cout << "O grafo e conexo" << endl;
+        }
+        else
+        {
+            cout << "O grafo nao e conexo" << endl;
+        }
+
+        cout << "O numero de componentes conexos e: " << connected_component_amount(components) << endl;
+        cout << "O numero de vertices no componente conexo de 6 e: " << vertices_amount_in_connected_component(components, 6) << endl;
+
+        // λ e κ sao calculados uma vez so para os seis valores de k
+        int lambda = minimum_edge_cut(snapshot).size;
+        for (int k = 1; k <= 6; ++k)
+            cout << "O grafo e " << k << "-aresta-conexo?: " << yes_no(lambda >= k) << endl;
         cout << "-------------------------------------------------------" << endl;
+        bool complete = is_complete(snapshot);
+        int kappa = -1;
+        for (int k = 1; k <= 6; ++k)
+        {
+            // Mesma regra de is_k_vertex_connected: grafo completo sempre, k > δ nunca
+            bool answer = complete;
+            if (!complete && k <= snapshot.getMinDegree())
+            {
+                if (kappa < 0)
+                    kappa = minimum_vertex_separator(snapshot).size;
+                answer = kappa >= k;
+            }
+            cout << "O grafo e " << k << "-vertice-conexo?: " << yes_no(answer) << endl;
+        }
+        cout << "O grafo e uma floresta?: " << yes_no(is_forest(components, snapshot.getSize())) << endl;
+
+        if (snapshot.getIsWeighted())
+        {
+            vector<Edge> mst_union_find = kruskal_mst(snapshot);
+            print_mst(mst_union_find);
+            cout << "-------------------------------------------------------" << endl;
+
+            vector<Edge> mst_prim = prim_mst(snapshot);
+            print_mst(mst_prim);
+            cout << "-------------------------------------------------------" << endl;
+        }
+        // Check if the graph has an Eulerian trail
+        EulerianTrailProperties properties = getEulerianPropetiesOfGraph(snapshot);
+        if (properties.isEulerian)
+        {
+            cout << "O grafo possui uma trilha Euleriana." << endl;
+            if (properties.hasTFE){
+                cout << "O grafo possui uma Trilha Fechada de Euler (TFE)." << endl;
+                cout << "A TFE comeca no vertice " << properties.startTFE << "." << endl;
+            }
+            if (properties.hasTAE){
+                cout << "O grafo possui uma Trilha Aberta de Euler (TAE)." << endl;
+                cout << "A TAE comeca no vertice " << properties.startTAE << " e termina no vertice " << properties.endTAE << "." << endl;
+            }
+            vector<Edge> eulerianTrail = options.eulerAlgorithm == EulerianTrailAlgorithm::Fleury
+                                             ? fleury_algorithm(graph, properties)
+                                             : hierholzer_algorithm(snapshot, properties);
+            cout << "A trilha Euleriana encontrada e: " << endl;
+            print_trail(eulerianTrail, false);
+        }
+        else
+        {
+            cout << "O grafo nao possui uma trilha Euleriana." << endl;
+        }
     }
-    // Check if the graph has an Eulerian trail
-    EulerianTrailProperties properties = getEulerianPropetiesOfGraph(graph);
-    if (properties.isEulerian)
+
+    void run_components(const Options &options, const CsrGraph &snapshot)
     {
-        cout << "O grafo possui uma trilha Euleriana." << endl;
-        if (properties.hasTFE){
-            cout << "O grafo possui uma Trilha Fechada de Euler (TFE)." << endl;
-            cout << "A TFE comeca no vertice " << properties.startTFE << "." << endl;
+        ComponentLabels components = component_labels(snapshot);
+        if (options.quiet)
+        {
+            cout << connected_component_amount(components) << endl;
+            if (options.vertex != 0)
+                cout << vertices_amount_in_connected_component(components, options.vertex) << endl;
+            return;
         }
-        if (properties.hasTAE){
-            cout << "O grafo possui uma Trilha Aberta de Euler (TAE)." << endl;
-            cout << "A TAE comeca no vertice " << properties.startTAE << " e termina no vertice " << properties.endTAE << "." << endl;
+        cout << (is_connected(components) ? "O grafo e conexo" : "O grafo nao e conexo") << endl;
+        cout << "O numero de componentes conexos e: " << connected_component_amount(components) << endl;
+        if (options.vertex != 0)
+        {
+            cout << "O numero de vertices no componente conexo de " << options.vertex << " e: "
+                 << vertices_amount_in_connected_component(components, options.vertex) << endl;
+        }
+    }
+
+    void run_kconn(const Options &options, const CsrGraph &snapshot)
+    {
+        if (options.edgeConnectivity)
+        {
+            bool answer = is_k_edge_connected(snapshot, options.k);
+            if (options.quiet)
+                cout << yes_no(answer) << endl;
+            else
+                cout << "O grafo e " << options.k << "-aresta-conexo?: " << yes_no(answer) << endl;
         }
-        vector<Edge> eulerianTrail = fleury_algorithm(graph, properties);
-        cout << "A trilha Euleriana encontrada e: " << endl;
-        for (const Edge& edge : eulerianTrail) {
-            cout << edge.u << " -> " << edge.v << endl;
+        if (options.vertexConnectivity)
+        {
+            bool answer = is_k_vertex_connected(snapshot, options.k);
+            if (options.quiet)
+                cout << yes_no(answer) << endl;
+            else
+                cout << "O grafo e " << options.k << "-vertice-conexo?: " << yes_no(answer) << endl;
         }
     }
-    else
+
+    void run_mst(const Options &options, const CsrGraph &snapshot)
     {
-        cout << "O grafo nao possui uma trilha Euleriana." << endl;
+        vector<Edge> mst;
+        if (options.mstAlgorithm == "prim")
+            mst = prim_mst(snapshot);
+        else if (options.mstAlgorithm == "filter-kruskal")
+            mst = filter_kruskal_mst(snapshot);
+        else if (options.mstAlgorithm == "boruvka")
+            mst = boruvka_mst(snapshot);
+        else
+            mst = kruskal_mst(snapshot);
+        print_mst(mst);
+        if (!options.quiet)
+        {
+            long long cost = 0;
+            for (const Edge &edge : mst)
+                cost += edge.weight;
+            cout << "Custo total: " << cost << endl;
+        }
     }
-    
-    return 0;
-}
\ No newline at end of file
+
+    void run_euler(const Options &options, const Graph &graph, const CsrGraph &snapshot)
+    {
+        EulerianTrailProperties properties = getEulerianPropetiesOfGraph(snapshot);
+        if (!properties.isEulerian)
+        {
+            if (!options.quiet)
+                cout << "O grafo nao possui uma trilha Euleriana." << endl;
+            return;
+        }
+        if (!options.quiet)
+        {
+            if (properties.hasTFE)
+                cout << "O grafo possui uma Trilha Fechada de Euler (TFE) que comeca no vertice " << properties.startTFE << "." << endl;
+            else
+                cout << "O grafo possui uma Trilha Aberta de Euler (TAE) do vertice " << properties.startTAE
+                     << " ao vertice " << properties.endTAE << "." << endl;
+        }
+        vector<Edge> trail = options.eulerAlgorithm == EulerianTrailAlgorithm::Fleury
+                                 ? fleury_algorithm(graph, properties)
+                                 : hierholzer_algorithm(snapshot, properties);
+        print_trail(trail, options.quiet);
+    }
+
+    bool run_serve(const Options &options, const CsrGraph &snapshot)
+    {
+        // O grafo e carregado uma vez; componentes, MST e pontes sao calculados na primeira consulta
+        GraphQueryEngine engine(snapshot);
+        QueryServerStats stats;
+        bool served = options.socketPath.empty()
+                          ? serve_stream(engine, 0, 1, options.protocol, stats)
+                          : serve_unix_socket(engine, options.socketPath, options.protocol, stats);
+        if (!options.quiet)
+            stats.print(cerr);
+        return served;
+    }
+
+    bool write_metrics(const Options &options)
+    {
+        if (options.metricsFormat.empty())
+            return true;
+        if (!GraphMetrics::enabled())
+            cerr << "Aviso: compilado sem GRAPH_METRICS, o relatorio sai vazio" << endl;
+        ofstream file;
+        if (!options.metricsOutput.empty())
+        {
+            file.open(options.metricsOutput);
+            if (!file)
+            {
+                cerr << "Error: Could not create " << options.metricsOutput << endl;
+                return false;
+            }
+        }
+        ostream &out = options.metricsOutput.empty() ? cerr : file;
+        if (options.metricsFormat == "json")
+            GraphMetrics::write_json(out);
+        else
+            GraphMetrics::write_prometheus(out);
+        return true;
+    }
+} // namespace
+
+int main(int argc, char const *argv[])
+{
+    Options options;
+    if (!parse_arguments(argc, argv, options))
+        return 1;
+
+    // So o relatorio completo, a listagem e o Fleury (que remove arestas) precisam das listas encadeadas
+    bool needsGraph = options.command == Command::Report || options.command == Command::Print ||
+                      (options.command == Command::Euler && options.eulerAlgorithm == EulerianTrailAlgorithm::Fleury);
+    Graph graph;
+    CsrGraph snapshot;
+    if (!load_input(options, needsGraph, graph, snapshot))
+        return 1;
+
+    bool ok = true;
+
+    switch (options.command)
+    {
+    case Command::Report:
+        run_report(options, graph, snapshot);
+        break;
+    case Command::Print:
+        graph.printGraph();
+        break;
+    case Command::Components:
+        run_components(options, snapshot);
+        break;
+    case Command::KConn:
+        run_kconn(options, snapshot);
+        break;
+    case Command::Forest:
+    {
+        bool forest = is_forest(snapshot);
+        if (options.quiet)
+            cout << yes_no(forest) << endl;
+        else
+            cout << "O grafo e uma floresta?: " << yes_no(forest) << endl;
+        break;
+    }
+    case Command::Mst:
+        run_mst(options, snapshot);
+        break;
+    case Command::Euler:
+        run_euler(options, graph, snapshot);
+        break;
+    case Command::Serve:
+        ok = run_serve(options, snapshot);
+        break;
+    }
+
+    return write_metrics(options) && ok ? 0 : 1;
+}
@@ -0,0 +1,76 @@
+#ifndef QUERY_ENGINE_HPP
+#define QUERY_ENGINE_HPP
+
+#include <cstdint>
+#include <list>
+#include <memory>
+#include "bridges.hpp"
+#include "csr_graph.hpp"
+#include "myDS.hpp"
+#include "shortest_paths.hpp"
+
+using namespace MyDataStructures;
+
+/**
+ * @brief Answers small queries against one loaded graph, computing what they need on first use
+ *
+ * Component labels, the minimum spanning forest weight and the bridges are each computed
+ * once, by the first query that needs them; shortest paths are kept for the most recently
+ * used sources. Vertices must be in 1..order() (see is_vertex). Not thread-safe: one engine
+ * answers one stream of queries at a time.
+ */
+class GraphQueryEngine
+{
+public:
+    static const int DISTANCE_CACHE_SOURCES = 8;
+
+    /**
+     * @brief Take a snapshot to answer queries about
+     * @param graph The snapshot (shares its arrays, e.g. with a mapped binary file)
+     */
+    explicit GraphQueryEngine(const CsrGraph &graph);
+
+    int order() const { return graph.getOrder(); }
+    bool is_vertex(int v) const { return v >= 1 && v <= graph.getOrder(); }
+
+    /**
+     * @brief Check if two vertices are in the same connected component
+     */
+    bool same_component(int u, int v);
+
+    /**
+     * @brief Number of vertices in the connected component of v
+     */
+    int component_size(int v);
+
+    /**
+     * @brief Number of connected components
+     */
+    int component_count();
+
+    /**
+     * @brief Total weight of a minimum spanning forest
+     */
+    std::int64_t mst_weight();
+
+    /**
+     * @brief Check if (u, v) is an edge of the graph and a bridge
+     */
+    bool is_bridge(int u, int v);
+
+    /**
+     * @brief Length of a shortest path from s to t, or -1 if t is not reachable from s
+     */
+    std::int64_t distance(int s, int t);
+
+private:
+    CsrGraph graph;
+    std::unique_ptr<ComponentLabels> components;   // nullptr ate a primeira consulta
+    std::unique_ptr<std::int64_t> minimumWeight;
+    std::unique_ptr<Biconnectivity> biconnectivity;
+    std::list<ShortestPaths> recentSources;        // Mais recente primeiro
+
+    const ComponentLabels &labels();
+};
+
+#endif // QUERY_ENGINE_HPP
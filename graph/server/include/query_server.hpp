@@ -0,0 +1,130 @@
+#ifndef QUERY_SERVER_HPP
+#define QUERY_SERVER_HPP
+
+#include <cstdint>
+#include <ostream>
+#include <string>
+#include <vector>
+#include "query_engine.hpp"
+
+#if defined(__unix__) || defined(__APPLE__)
+#define GRAPH_HAS_UNIX_SOCKETS 1
+#else
+#define GRAPH_HAS_UNIX_SOCKETS 0
+#endif
+
+/**
+ * @brief Wire formats of the query server
+ *
+ * Text: one query per line, one answer line per query, in order:
+ *   same u v | size v | components | mst | bridge u v | dist s t | stats | quit
+ * Answers are numbers (1/0 for yes/no, -1 for an unreachable vertex), one line of JSON for
+ * stats, or "ERR <message>". A line longer than 4096 bytes is answered "ERR line too long" and
+ * dropped up to its newline.
+ *
+ * Binary (little-endian): request = u32 length, u8 opcode, length - 1 bytes of int32
+ * arguments; response = u32 length, u8 status (0 ok, 1 error), then an int64 value or the
+ * error message. Opcodes are the QueryKind values (quit = 0).
+ *
+ * In both formats a client may send many queries without waiting: answers are written in
+ * order, once per batch of input read.
+ */
+enum class QueryProtocol
+{
+    Text,
+    Binary
+};
+
+/**
+ * @brief Kinds of query, also the opcodes of the binary protocol
+ */
+enum class QueryKind
+{
+    Quit = 0,
+    Same = 1,       // same u v: 1 if u and v are in the same component
+    Size = 2,       // size v: vertices in the component of v
+    Components = 3, // components: number of connected components
+    Mst = 4,        // mst: weight of a minimum spanning forest
+    Bridge = 5,     // bridge u v: 1 if (u, v) is an edge and a bridge
+    Distance = 6,   // dist s t: length of a shortest path, -1 if none
+    Stats = 7       // stats: latency percentiles so far (text protocol only)
+};
+
+const int QUERY_KIND_COUNT = 8;
+
+/**
+ * @brief Name of a query kind, as written in the text protocol
+ */
+const char *query_kind_name(QueryKind kind);
+
+/**
+ * @brief Log-linear latency histogram (16 sub-buckets per power of two, at most 6.25% error)
+ * Memory stays constant however many samples are recorded.
+ */
+class LatencyHistogram
+{
+public:
+    LatencyHistogram();
+
+    void record(std::uint64_t nanoseconds);
+    std::uint64_t count() const { return samples; }
+    std::uint64_t max() const { return largest; }
+
+    /**
+     * @brief Latency below which a fraction p of the samples fall (upper edge of its bucket)
+     * @param p Fraction in [0, 1], e.g. 0.99
+     */
+    std::uint64_t percentile(double p) const;
+
+private:
+    static const int SUB_BUCKET_BITS = 4;
+    std::vector<std::uint64_t> buckets;
+    std::uint64_t samples;
+    std::uint64_t largest;
+};
+
+/**
+ * @brief Per-kind latency of the queries answered (time to parse, compute and encode the answer)
+ */
+struct QueryServerStats
+{
+    LatencyHistogram latency[QUERY_KIND_COUNT];
+    std::uint64_t errors;
+
+    QueryServerStats() : errors(0) {}
+
+    /**
+     * @brief Write a table with count, p50, p90, p99 and max per kind of query
+     */
+    void print(std::ostream &out) const;
+
+    /**
+     * @brief The same numbers as one line of JSON (answer of the stats query)
+     */
+    std::string json() const;
+};
+
+/**
+ * @brief Answer the queries read from a file descriptor until end of input or quit
+ * @param engine The graph to query
+ * @param input Descriptor to read queries from (e.g. 0 for stdin)
+ * @param output Descriptor to write answers to (e.g. 1 for stdout)
+ * @param protocol Wire format
+ * @param stats Receives the latency of every query
+ * @return false on a read or write error, or a malformed binary frame
+ * Needs a POSIX system (GRAPH_HAS_UNIX_SOCKETS); elsewhere it reports an error and returns false.
+ */
+bool serve_stream(GraphQueryEngine &engine, int input, int output, QueryProtocol protocol, QueryServerStats &stats);
+
+/**
+ * @brief Listen on a Unix socket and answer its clients, one connection at a time
+ * Runs until SIGINT or SIGTERM; the socket file is removed on exit.
+ * @param engine The graph to query (its caches are shared by every client)
+ * @param path Path of the socket (an existing socket there is replaced)
+ * @param protocol Wire format
+ * @param stats Receives the latency of every query
+ * @return false if the socket could not be created (message on stderr)
+ */
+bool serve_unix_socket(GraphQueryEngine &engine, const std::string &path, QueryProtocol protocol, QueryServerStats &stats);
+
+#endif // QUERY_SERVER_HPP
@@ -0,0 +1,74 @@
+#include "query_engine.hpp"
+#include "connected.hpp"
+#include "minimum_spanning_tree.hpp"
+
+const int GraphQueryEngine::DISTANCE_CACHE_SOURCES;
+
+GraphQueryEngine::GraphQueryEngine(const CsrGraph &graph) : graph(graph)
+{
+}
+
+const ComponentLabels &GraphQueryEngine::labels()
+{
+    if (!components)
+        components.reset(new ComponentLabels(component_labels(graph)));
+    return *components;
+}
+
+bool GraphQueryEngine::same_component(int u, int v)
+{
+    return labels().same_component(u, v);
+}
+
+int GraphQueryEngine::component_size(int v)
+{
+    return labels().component_size(v);
+}
+
+int GraphQueryEngine::component_count()
+{
+    return labels().count;
+}
+
+std::int64_t GraphQueryEngine::mst_weight()
+{
+    if (!minimumWeight)
+    {
+        std::int64_t total = 0;
+        for (const Edge &edge : kruskal_mst(graph))
+            total += edge.weight;
+        minimumWeight.reset(new std::int64_t(total));
+    }
+    return *minimumWeight;
+}
+
+bool GraphQueryEngine::is_bridge(int u, int v)
+{
+    if (!biconnectivity)
+        biconnectivity.reset(new Biconnectivity(find_bridges(graph)));
+    return biconnectivity->is_bridge(u, v);
+}
+
+std::int64_t GraphQueryEngine::distance(int s, int t)
+{
+    // Componentes diferentes: nem precisa rodar o Dijkstra
+    if (!same_component(s, t))
+        return -1;
+
+    auto cached = recentSources.begin();
+    while (cached != recentSources.end() && cached->source != s)
+        ++cached;
+    if (cached == recentSources.end())
+    {
+        if (static_cast<int>(recentSources.size()) == DISTANCE_CACHE_SOURCES)
+            recentSources.pop_back();
+        recentSources.push_front(dijkstra(graph, s));
+    }
+    else if (cached != recentSources.begin())
+    {
+        recentSources.splice(recentSources.begin(), recentSources, cached);
+    }
+
+    const ShortestPaths &paths = recentSources.front();
+    return paths.reached(t) ? paths.distance[t] : -1;
+}
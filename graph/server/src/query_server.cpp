@@ -0,0 +1,487 @@
+#include "query_server.hpp"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+
+#if GRAPH_HAS_UNIX_SOCKETS
+#include <cerrno>
+#include <csignal>
+#include <cstring>
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <sys/un.h>
+#include <unistd.h>
+#endif
+
+namespace
+{
+    const char *const QUERY_NAMES[QUERY_KIND_COUNT] = {"quit", "same", "size", "components", "mst", "bridge", "dist", "stats"};
+    const int QUERY_ARITY[QUERY_KIND_COUNT] = {0, 2, 1, 0, 0, 2, 2, 0};
+
+    const std::size_t READ_CHUNK = 64 * 1024;
+    const std::uint32_t MAX_FRAME_LENGTH = 1 + 4 * 4; // Opcode e no maximo quatro argumentos
+    const std::size_t MAX_LINE_LENGTH = 4096;         // Consultas de texto cabem com folga
+
+    // Resposta de uma consulta: valor ou mensagem de erro
+    struct Answer
+    {
+        bool ok;
+        std::int64_t value;
+        std::string text; // JSON do stats ou mensagem de erro
+    };
+
+    Answer error(const std::string &message)
+    {
+        return {false, 0, message};
+    }
+
+    Answer value(std::int64_t number)
+    {
+        return {true, number, std::string()};
+    }
+
+    Answer answer(GraphQueryEngine &engine, QueryKind kind, const int *args, const QueryServerStats &stats)
+    {
+        for (int i = 0; i < QUERY_ARITY[static_cast<int>(kind)]; ++i)
+        {
+            if (!engine.is_vertex(args[i]))
+                return error("vertex out of range");
+        }
+        switch (kind)
+        {
+        case QueryKind::Same:
+            return value(engine.same_component(args[0], args[1]) ? 1 : 0);
+        case QueryKind::Size:
+            return value(engine.component_size(args[0]));
+        case QueryKind::Components:
+            return value(engine.component_count());
+        case QueryKind::Mst:
+            return value(engine.mst_weight());
+        case QueryKind::Bridge:
+            return value(engine.is_bridge(args[0], args[1]) ? 1 : 0);
+        case QueryKind::Distance:
+            return value(engine.distance(args[0], args[1]));
+        case QueryKind::Stats:
+            return {true, 0, stats.json()};
+        default:
+            return error("unknown query");
+        }
+    }
+
+    std::uint64_t elapsed_ns(std::chrono::steady_clock::time_point start)
+    {
+        return static_cast<std::uint64_t>(
+            std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start).count());
+    }
+
+    bool parse_int(const std::string &token, int &result)
+    {
+        if (token.empty())
+            return false;
+        char *end = nullptr;
+        long number = std::strtol(token.c_str(), &end, 10);
+        if (*end != '\0' || number < -2147483647L - 1 || number > 2147483647L)
+            return false;
+        result = static_cast<int>(number);
+        return true;
+    }
+
+    void reject_long_line(std::string &out, QueryServerStats &stats)
+    {
+        out += "ERR line too long\n";
+        stats.errors++;
+    }
+
+    // Responde uma linha do protocolo texto; retorna false no quit
+    bool answer_line(GraphQueryEngine &engine, const std::string &line, std::string &out, QueryServerStats &stats)
+    {
+        auto start = std::chrono::steady_clock::now();
+        std::istringstream tokens(line);
+        std::string command;
+        if (!(tokens >> command))
+            return true; // Linha em branco: sem resposta
+
+        int kind = 0;
+        while (kind < QUERY_KIND_COUNT && command != QUERY_NAMES[kind])
+            ++kind;
+        if (kind == static_cast<int>(QueryKind::Quit))
+            return false;
+
+        Answer result;
+        int args[2] = {0, 0};
+        if (kind == QUERY_KIND_COUNT)
+        {
+            result = error("unknown query '" + command + "'");
+        }
+        else
+        {
+            int arity = QUERY_ARITY[kind];
+            std::vector<std::string> words;
+            std::string word;
+            while (tokens >> word)
+                words.push_back(word);
+            bool valid = static_cast<int>(words.size()) == arity;
+            for (int i = 0; valid && i < arity; ++i)
+                valid = parse_int(words[i], args[i]);
+            if (!valid)
+                result = error(std::string("usage: ") + command + (arity == 0 ? "" : arity == 1 ? " v" : " u v"));
+            else
+                result = answer(engine, static_cast<QueryKind>(kind), args, stats);
+        }
+
+        if (result.ok)
+            out += result.text.empty() ? std::to_string(result.value) : result.text;
+        else
+            out += "ERR " + result.text;
+        out += '\n';
+
+        if (!result.ok)
+            stats.errors++;
+        else
+            stats.latency[kind].record(elapsed_ns(start));
+        return true;
+    }
+
+    std::uint32_t read_u32(const char *bytes)
+    {
+        const unsigned char *b = reinterpret_cast<const unsigned char *>(bytes);
+        return static_cast<std::uint32_t>(b[0]) | (static_cast<std::uint32_t>(b[1]) << 8) |
+               (static_cast<std::uint32_t>(b[2]) << 16) | (static_cast<std::uint32_t>(b[3]) << 24);
+    }
+
+    void write_le(std::string &out, std::uint64_t number, int bytes)
+    {
+        for (int i = 0; i < bytes; ++i)
+            out += static_cast<char>((number >> (8 * i)) & 0xFF);
+    }
+
+    // Responde um quadro do protocolo binario (opcode + argumentos); retorna false no quit
+    bool answer_frame(GraphQueryEngine &engine, const char *frame, std::uint32_t length, std::string &out,
+                      QueryServerStats &stats)
+    {
+        auto start = std::chrono::steady_clock::now();
+        int kind = static_cast<unsigned char>(frame[0]);
+        if (kind == static_cast<int>(QueryKind::Quit))
+            return false;
+
+        Answer result;
+        int args[4] = {0, 0, 0, 0};
+        if (kind >= QUERY_KIND_COUNT || kind == static_cast<int>(QueryKind::Stats))
+            result = error("unknown opcode " + std::to_string(kind));
+        else if (length != 1 + 4 * static_cast<std::uint32_t>(QUERY_ARITY[kind]))
+            result = error(std::string("wrong number of arguments for ") + QUERY_NAMES[kind]);
+        else
+        {
+            for (int i = 0; i < QUERY_ARITY[kind]; ++i)
+                args[i] = static_cast<std::int32_t>(read_u32(frame + 1 + 4 * i));
+            result = answer(engine, static_cast<QueryKind>(kind), args, stats);
+        }
+
+        if (result.ok)
+        {
+            write_le(out, 1 + 8, 4);
+            out += '\0';
+            write_le(out, static_cast<std::uint64_t>(result.value), 8);
+            stats.latency[kind].record(elapsed_ns(start));
+        }
+        else
+        {
+            write_le(out, 1 + result.text.size(), 4);
+            out += '\1';
+            out += result.text;
+            stats.errors++;
+        }
+        return true;
+    }
+
+#if GRAPH_HAS_UNIX_SOCKETS
+    volatile std::sig_atomic_t stopRequested = 0;
+
+    void request_stop(int)
+    {
+        stopRequested = 1;
+    }
+
+    bool write_all(int fd, const std::string &bytes)
+    {
+        std::size_t written = 0;
+        while (written < bytes.size())
+        {
+            ssize_t n = ::write(fd, bytes.data() + written, bytes.size() - written);
+            if (n < 0 && errno == EINTR)
+                continue;
+            if (n <= 0)
+                return false;
+            written += static_cast<std::size_t>(n);
+        }
+        return true;
+    }
+#endif
+} // namespace
+
+const char *query_kind_name(QueryKind kind)
+{
+    return QUERY_NAMES[static_cast<int>(kind)];
+}
+
+LatencyHistogram::LatencyHistogram() : buckets((64 - SUB_BUCKET_BITS + 1) << SUB_BUCKET_BITS, 0), samples(0), largest(0)
+{
+}
+
+void LatencyHistogram::record(std::uint64_t nanoseconds)
+{
+    // Abaixo de 16: um bucket por valor; acima, 16 buckets por potencia de 2
+    const std::uint64_t subBuckets = 1u << SUB_BUCKET_BITS;
+    std::size_t index;
+    if (nanoseconds < subBuckets)
+        index = static_cast<std::size_t>(nanoseconds);
+    else
+    {
+        int exponent = 63;
+        while (!(nanoseconds >> exponent))
+            --exponent;
+        int shift = exponent - SUB_BUCKET_BITS;
+        index = static_cast<std::size_t>((shift + 1) << SUB_BUCKET_BITS) +
+                static_cast<std::size_t>((nanoseconds >> shift) & (subBuckets - 1));
+    }
+    buckets[index]++;
+    samples++;
+    largest = std::max(largest, nanoseconds);
+}
+
+std::uint64_t LatencyHistogram::percentile(double p) const
+{
+    if (samples == 0)
+        return 0;
+    std::uint64_t rank = static_cast<std::uint64_t>(std::ceil(std::min(std::max(p, 0.0), 1.0) * samples));
+    rank = std::max<std::uint64_t>(rank, 1);
+
+    const std::uint64_t subBuckets = 1u << SUB_BUCKET_BITS;
+    std::uint64_t seen = 0;
+    for (std::size_t index = 0; index < buckets.size(); ++index)
+    {
+        seen += buckets[index];
+        if (seen < rank)
+            continue;
+        if (index < subBuckets)
+            return index;
+        int shift = static_cast<int>(index >> SUB_BUCKET_BITS) - 1;
+        std::uint64_t lower = (subBuckets + (index & (subBuckets - 1))) << shift;
+        return std::min(largest, lower + (std::uint64_t(1) << shift) - 1);
+    }
+    return largest;
+}
+
+void QueryServerStats::print(std::ostream &out) const
+{
+    out << "Latencia por consulta (microssegundos):\n";
+    out << std::left << std::setw(12) << "consulta" << std::right << std::setw(10) << "total" << std::setw(10) << "p50"
+        << std::setw(10) << "p90" << std::setw(10) << "p99" << std::setw(10) << "max" << "\n";
+    out << std::fixed << std::setprecision(1);
+    for (int kind = 1; kind < QUERY_KIND_COUNT; ++kind)
+    {
+        const LatencyHistogram &histogram = latency[kind];
+        if (histogram.count() == 0)
+            continue;
+        out << std::left << std::setw(12) << QUERY_NAMES[kind] << std::right << std::setw(10) << histogram.count();
+        for (double p : {0.5, 0.9, 0.99})
+            out << std::setw(10) << histogram.percentile(p) / 1000.0;
+        out << std::setw(10) << histogram.max() / 1000.0 << "\n";
+    }
+    out << std::defaultfloat;
+    out << "Consultas com erro: " << errors << "\n";
+}
+
+std::string QueryServerStats::json() const
+{
+    std::ostringstream out;
+    out << "{";
+    for (int kind = 1; kind < QUERY_KIND_COUNT; ++kind)
+    {
+        const LatencyHistogram &histogram = latency[kind];
+        out << (kind == 1 ? "" : ", ") << "\"" << QUERY_NAMES[kind] << "\": {\"count\": " << histogram.count()
+            << ", \"p50_ns\": " << histogram.percentile(0.5) << ", \"p90_ns\": " << histogram.percentile(0.9)
+            << ", \"p99_ns\": " << histogram.percentile(0.99) << ", \"max_ns\": " << histogram.max() << "}";
+    }
+    out << ", \"errors\": " << errors << "}";
+    return out.str();
+}
+
+#if GRAPH_HAS_UNIX_SOCKETS
+
+bool serve_stream(GraphQueryEngine &engine, int input, int output, QueryProtocol protocol, QueryServerStats &stats)
+{
+    std::vector<char> chunk(READ_CHUNK);
+    std::string pending;      // Bytes recebidos que ainda nao formam uma consulta completa
+    std::size_t scanned = 0;  // Inicio de pending ja examinado sem achar '\n'
+    bool skipping = false;    // Descartando o resto de uma linha longa demais
+    std::string answers;
+    bool running = true;
+
+    while (running)
+    {
+        ssize_t n = ::read(input, chunk.data(), chunk.size());
+        if (n < 0 && errno == EINTR && !stopRequested)
+            continue;
+        if (n < 0)
+            return stopRequested != 0;
+        if (n == 0)
+            break;
+        pending.append(chunk.data(), static_cast<std::size_t>(n));
+
+        // Responde todas as consultas completas deste bloco e escreve as respostas de uma vez
+        std::size_t consumed = 0;
+        answers.clear();
+        if (protocol == QueryProtocol::Text)
+        {
+            // A busca pelo '\n' recomeca onde a leitura anterior parou
+            std::size_t newline;
+            while (running && (newline = pending.find('\n', std::max(consumed, scanned))) != std::string::npos)
+            {
+                if (skipping)
+                    skipping = false; // Fim de uma linha longa ja respondida
+                else if (newline - consumed > MAX_LINE_LENGTH)
+                    reject_long_line(answers, stats);
+                else
+                    running = answer_line(engine, pending.substr(consumed, newline - consumed), answers, stats);
+                consumed = newline + 1;
+            }
+
+            // Linha longa demais sem '\n': responde o erro uma vez e descarta ate o fim dela
+            if (running && pending.size() - consumed > MAX_LINE_LENGTH)
+            {
+                if (!skipping)
+                    reject_long_line(answers, stats);
+                skipping = true;
+                consumed = pending.size();
+            }
+        }
+        else
+        {
+            while (running && pending.size() - consumed >= 4)
+            {
+                std::uint32_t length = read_u32(pending.data() + consumed);
+                if (length == 0 || length > MAX_FRAME_LENGTH)
+                {
+                    // Sem como achar o proximo quadro: responde o erro e encerra a conexao
+                    std::string message = "bad frame length " + std::to_string(length);
+                    write_le(answers, 1 + message.size(), 4);
+                    answers += '\1';
+                    answers += message;
+                    write_all(output, answers);
+                    std::cerr << "Error: " << message << std::endl;
+                    return false;
+                }
+                if (pending.size() - consumed < 4 + length)
+                    break;
+                running = answer_frame(engine, pending.data() + consumed + 4, length, answers, stats);
+                consumed += 4 + length;
+            }
+        }
+        pending.erase(0, consumed);
+        scanned = pending.size();
+        if (!write_all(output, answers))
+            return false;
+    }
+
+    // Ultima linha sem '\n' no fim da entrada
+    if (running && protocol == QueryProtocol::Text && !skipping && !pending.empty())
+    {
+        answers.clear();
+        answer_line(engine, pending, answers, stats);
+        return write_all(output, answers);
+    }
+    return true;
+}
+
+bool serve_unix_socket(GraphQueryEngine &engine, const std::string &path, QueryProtocol protocol, QueryServerStats &stats)
+{
+    sockaddr_un address;
+    std::memset(&address, 0, sizeof(address));
+    address.sun_family = AF_UNIX;
+    if (path.empty() || path.size() >= sizeof(address.sun_path))
+    {
+        std::cerr << "Error: Socket path must have 1 to " << sizeof(address.sun_path) - 1 << " characters" << std::endl;
+        return false;
+    }
+    std::memcpy(address.sun_path, path.c_str(), path.size());
+
+    // Substitui um socket antigo (de um servidor que nao encerrou), mas nunca um arquivo comum
+    struct stat existing;
+    if (lstat(path.c_str(), &existing) == 0)
+    {
+        if (!S_ISSOCK(existing.st_mode))
+        {
+            std::cerr << "Error: " << path << " exists and is not a socket" << std::endl;
+            return false;
+        }
+        unlink(path.c_str());
+    }
+
+    int listener = socket(AF_UNIX, SOCK_STREAM, 0);
+    if (listener < 0)
+    {
+        std::cerr << "Error: Could not create socket: " << std::strerror(errno) << std::endl;
+        return false;
+    }
+    if (bind(listener, reinterpret_cast<sockaddr *>(&address), sizeof(address)) != 0 || listen(listener, 16) != 0)
+    {
+        std::cerr << "Error: Could not listen on " << path << ": " << std::strerror(errno) << std::endl;
+        ::close(listener);
+        return false;
+    }
+
+    // Sem SA_RESTART: SIGINT/SIGTERM interrompem o accept/read e encerram o servidor
+    struct sigaction stop, previousInt, previousTerm, previousPipe;
+    std::memset(&stop, 0, sizeof(stop));
+    stop.sa_handler = request_stop;
+    sigemptyset(&stop.sa_mask);
+    sigaction(SIGINT, &stop, &previousInt);
+    sigaction(SIGTERM, &stop, &previousTerm);
+    // Cliente que fecha a conexao antes de ler as respostas nao derruba o servidor
+    struct sigaction ignore = stop;
+    ignore.sa_handler = SIG_IGN;
+    sigaction(SIGPIPE, &ignore, &previousPipe);
+
+    stopRequested = 0;
+    while (!stopRequested)
+    {
+        int client = accept(listener, nullptr, nullptr);
+        if (client < 0)
+        {
+            if (errno == EINTR)
+                continue;
+            std::cerr << "Error: accept failed: " << std::strerror(errno) << std::endl;
+            break;
+        }
+        serve_stream(engine, client, client, protocol, stats);
+        ::close(client);
+    }
+
+    sigaction(SIGINT, &previousInt, nullptr);
+    sigaction(SIGTERM, &previousTerm, nullptr);
+    sigaction(SIGPIPE, &previousPipe, nullptr);
+    ::close(listener);
+    unlink(path.c_str());
+    return true;
+}
+
+#else
+
+bool serve_stream(GraphQueryEngine &, int, int, QueryProtocol, QueryServerStats &)
+{
+    std::cerr << "Error: Server mode needs a POSIX system" << std::endl;
+    return false;
+}
+
+bool serve_unix_socket(GraphQueryEngine &, const std::string &, QueryProtocol, QueryServerStats &)
+{
+    std::cerr << "Error: Unix sockets are not available on this system" << std::endl;
+    return false;
+}
+
+#endif
@@ -0,0 +1,116 @@
+#include "test_utils.hpp"
+#include "binary_graph.hpp"
+#include "graph.hpp"
+#include <cstddef>
+#include <cstring>
+#include <sstream>
+
+namespace
+{
+    const char *PATH = "binary_graph_case.csr";
+
+    bool same_snapshot(const CsrGraph &a, const CsrGraph &b)
+    {
+        if (a.getOrder() != b.getOrder() || a.getSize() != b.getSize() || a.getIsWeighted() != b.getIsWeighted() ||
+            a.getMinDegree() != b.getMinDegree() || a.getMaxDegree() != b.getMaxDegree())
+            return false;
+        for (int v = 0; v <= a.getOrder() + 1; ++v)
+        {
+            if (a.offsetsData()[v] != b.offsetsData()[v])
+                return false;
+        }
+        for (std::uint64_t slot = 0; slot < 2 * static_cast<std::uint64_t>(a.getSize()); ++slot)
+        {
+            if (a.target(slot) != b.target(slot) || a.weight(slot) != b.weight(slot) || a.edgeId(slot) != b.edgeId(slot))
+                return false;
+        }
+        return true;
+    }
+
+    std::string read_file(const std::string &path)
+    {
+        std::ifstream in(path, std::ios::binary);
+        std::ostringstream content;
+        content << in.rdbuf();
+        return content.str();
+    }
+
+    /**
+     * @brief Write a copy of a valid file with one header field replaced, then try to open it
+     */
+    template <typename T>
+    bool open_patched(const std::string &valid, std::size_t fieldOffset, T value)
+    {
+        std::string bytes = valid;
+        std::memcpy(&bytes[fieldOffset], &value, sizeof(value));
+        GraphTests::write_file(PATH, bytes);
+        CsrGraph graph;
+        return open_binary(PATH, graph);
+    }
+
+    void test_random_round_trips()
+    {
+        std::mt19937 random(5);
+        for (int round = 0; round < 40; ++round)
+        {
+            int n = 1 + static_cast<int>(random() % 30);
+            Graph graph(n, round % 2 == 0);
+            graph.addEdges(GraphTests::random_edges(random, n, static_cast<int>(random() % 60), 50, true));
+
+            CHECK(save_binary(graph, PATH));
+            CHECK(is_binary_graph(PATH));
+            CsrGraph opened;
+            CHECK(open_binary(PATH, opened));
+            CHECK(same_snapshot(opened, graph.freeze()));
+        }
+    }
+
+    void test_corrupted_headers()
+    {
+        Graph graph(6, true);
+        graph.addEdges({Edge(1, 2, 3), Edge(2, 3, 4), Edge(3, 1, 5), Edge(4, 5, 6)});
+        CHECK(save_binary(graph, PATH));
+        const std::string valid = read_file(PATH);
+        BinaryGraphHeader header;
+        std::memcpy(&header, valid.data(), sizeof(header));
+
+        const std::uint64_t huge = std::uint64_t(1) << 40;
+        CHECK(!open_patched(valid, offsetof(BinaryGraphHeader, numVertices), huge));
+        CHECK(!open_patched(valid, offsetof(BinaryGraphHeader, numEdges), huge));
+        CHECK(!open_patched(valid, offsetof(BinaryGraphHeader, targetsStart), std::uint64_t(1) << 50));
+        CHECK(!open_patched(valid, offsetof(BinaryGraphHeader, offsetsStart), ~std::uint64_t(63)));
+        CHECK(!open_patched(valid, offsetof(BinaryGraphHeader, edgeIdsStart), header.fileSize));
+        CHECK(!open_patched(valid, offsetof(BinaryGraphHeader, weightsStart), header.targetsStart)); // sobrepostos
+        CHECK(!open_patched(valid, offsetof(BinaryGraphHeader, weightsStart), std::uint64_t(0)));
+        CHECK(!open_patched(valid, offsetof(BinaryGraphHeader, fileSize), header.fileSize + 64));
+        CHECK(!open_patched(valid, offsetof(BinaryGraphHeader, numVertices), std::uint64_t(7))); // ultimo offset errado
+        CHECK(!open_patched(valid, offsetof(BinaryGraphHeader, version), std::uint32_t(99)));
+        CHECK(!open_patched(valid, offsetof(BinaryGraphHeader, magic), std::uint64_t(0)));
+
+        // O caso do crash: n = 2^40 e targetsStart = 2^50 juntos
+        std::string bytes = valid;
+        std::memcpy(&bytes[offsetof(BinaryGraphHeader, numVertices)], &huge, sizeof(huge));
+        const std::uint64_t far = std::uint64_t(1) << 50;
+        std::memcpy(&bytes[offsetof(BinaryGraphHeader, targetsStart)], &far, sizeof(far));
+        GraphTests::write_file(PATH, bytes);
+        CsrGraph opened;
+        CHECK(!open_binary(PATH, opened));
+
+        GraphTests::write_file(PATH, valid.substr(0, valid.size() - 4));
+        CHECK(!open_binary(PATH, opened));
+        GraphTests::write_file(PATH, valid.substr(0, 100));
+        CHECK(!open_binary(PATH, opened));
+
+        // O arquivo original continua valido
+        GraphTests::write_file(PATH, valid);
+        CHECK(open_binary(PATH, opened));
+        CHECK(same_snapshot(opened, graph.freeze()));
+    }
+} // namespace
+
+int main()
+{
+    test_random_round_trips();
+    test_corrupted_headers();
+    return GraphTests::result();
+}
@@ -0,0 +1,91 @@
+#include "test_utils.hpp"
+#include "bridges.hpp"
+#include "graph.hpp"
+#include "utils.hpp"
+
+namespace
+{
+    /**
+     * @brief Compare with removing each edge and each vertex and counting the components left
+     */
+    void check_biconnectivity(const Biconnectivity &result, int n, const std::vector<Edge> &edges)
+    {
+        int components = GraphTests::brute_components(n, edges);
+
+        // Pontes: a aresta cuja remocao aumenta o numero de componentes
+        std::vector<std::vector<bool>> bridge(n + 1, std::vector<bool>(n + 1, false));
+        int bridges = 0;
+        for (std::size_t i = 0; i < edges.size(); ++i)
+        {
+            std::vector<Edge> rest(edges);
+            rest.erase(rest.begin() + static_cast<long>(i));
+            if (GraphTests::brute_components(n, rest) > components)
+            {
+                bridge[edges[i].u][edges[i].v] = bridge[edges[i].v][edges[i].u] = true;
+                ++bridges;
+            }
+        }
+        for (int u = 1; u <= n; ++u)
+            for (int v = 1; v <= n; ++v)
+                CHECK_EQ(result.is_bridge(u, v), bridge[u][v]);
+        CHECK_EQ(static_cast<int>(result.bridges.size()), bridges);
+        for (const Edge &edge : result.bridges)
+            CHECK(bridge[edge.u][edge.v]);
+
+        // Articulacoes: o vertice cuja remocao aumenta o numero de componentes dos que sobram
+        std::vector<int> expected;
+        for (int v = 1; v <= n; ++v)
+        {
+            bool articulation = GraphTests::brute_components(n, edges, std::uint64_t(1) << (v - 1)) > components;
+            CHECK_EQ(result.is_articulation_point(v), articulation);
+            if (articulation)
+                expected.push_back(v);
+        }
+        CHECK(result.articulationPoints == expected);
+    }
+
+    void test_against_brute_force()
+    {
+        std::mt19937 random(9);
+        for (int round = 0; round < 500; ++round)
+        {
+            int n = 1 + static_cast<int>(random() % 9);
+            // Poucas arestas para haver pontes; lacos e paralelas sempre possiveis
+            std::vector<Edge> edges = GraphTests::random_edges(random, n, static_cast<int>(random() % (n + 4)), 1, true);
+            if (!edges.empty() && random() % 2 == 0)
+            {
+                Edge parallel = edges[random() % edges.size()];
+                edges.push_back(parallel);
+            }
+            Graph graph(n);
+            graph.addEdges(edges);
+
+            check_biconnectivity(find_bridges(graph), n, edges);
+            check_biconnectivity(find_bridges(graph.freeze()), n, edges);
+            for (const Edge &edge : edges)
+                CHECK_EQ(isBridge(graph, edge.u, edge.v), find_bridges(graph).is_bridge(edge.u, edge.v));
+        }
+    }
+
+    void test_parallel_edges()
+    {
+        // 1-2 dupla e 2-3 simples: so 2-3 e ponte, e 2 e articulacao
+        Graph graph(3);
+        graph.addEdges({Edge(1, 2, 1), Edge(2, 3, 1), Edge(2, 1, 1)});
+        Biconnectivity result = find_bridges(graph);
+        CHECK(!result.is_bridge(1, 2));
+        CHECK(result.is_bridge(3, 2));
+        CHECK(result.articulationPoints == std::vector<int>{2});
+
+        // Removida uma das paralelas, 1-2 vira ponte
+        graph.removeEdge(1, 2);
+        CHECK(isBridge(graph, 1, 2));
+    }
+} // namespace
+
+int main()
+{
+    test_against_brute_force();
+    test_parallel_edges();
+    return GraphTests::result();
+}
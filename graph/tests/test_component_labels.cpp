@@ -0,0 +1,86 @@
+#include "test_utils.hpp"
+#include "connected.hpp"
+#include "graph.hpp"
+#include <algorithm>
+#include <map>
+
+namespace
+{
+    /**
+     * @brief Check labels against the union-find of the test: same partition, count, sizes and histogram
+     */
+    void check_labels(const ComponentLabels &labels, int n, const std::vector<Edge> &edges)
+    {
+        std::vector<int> expected;
+        int count = GraphTests::brute_components(n, edges, 0, &expected);
+        CHECK_EQ(labels.count, count);
+        CHECK_EQ(static_cast<int>(labels.label.size()), n + 1);
+        CHECK_EQ(static_cast<int>(labels.sizes.size()), count);
+
+        // Mesma particao: o rotulo de um representante determina o de todos os vertices
+        std::map<int, int> labelOf;
+        std::map<int, int> sizeOf;
+        for (int v = 1; v <= n; ++v)
+        {
+            auto found = labelOf.insert(std::make_pair(expected[v], labels.label[v]));
+            CHECK_EQ(found.first->second, labels.label[v]);
+            sizeOf[expected[v]]++;
+        }
+        std::map<int, int> distinct;
+        for (const auto &entry : labelOf)
+            distinct[entry.second]++;
+        CHECK_EQ(static_cast<int>(distinct.size()), count);
+
+        std::map<int, int> histogram;
+        for (int v = 1; v <= n; ++v)
+            CHECK_EQ(labels.component_size(v), sizeOf[expected[v]]);
+        for (const auto &entry : sizeOf)
+            histogram[entry.second]++;
+        CHECK(std::vector<std::pair<int, int>>(histogram.begin(), histogram.end()) == labels.histogram);
+        CHECK_EQ(labels.connected(), count <= 1);
+    }
+
+    void test_small_graphs()
+    {
+        std::mt19937 random(15);
+        for (int round = 0; round < 300; ++round)
+        {
+            int n = static_cast<int>(random() % 40);
+            std::vector<Edge> edges = GraphTests::random_edges(random, n, static_cast<int>(random() % (n + 1)), 1, true);
+            Graph graph(n);
+            graph.addEdges(edges);
+            for (int threads : {1, 2, 4})
+            {
+                check_labels(component_labels(graph, threads), n, edges);
+                check_labels(component_labels(graph.freeze(), threads), n, edges);
+            }
+            CHECK_EQ(is_connected(graph), GraphTests::brute_components(n, edges) <= 1);
+            CHECK_EQ(connected_component_amount(graph), GraphTests::brute_components(n, edges));
+        }
+    }
+
+    void test_giant_component()
+    {
+        // Uma componente gigante e varias pequenas: os vertices fora da amostra dominante
+        // precisam ligar o resto das suas arestas
+        std::mt19937 random(16);
+        for (int round = 0; round < 6; ++round)
+        {
+            int n = 30000;
+            std::vector<Edge> edges = GraphTests::random_edges(random, n / 2, 60000, 1, false);
+            for (const Edge &edge : GraphTests::random_edges(random, n / 2, n / 4 + round * 2000, 1, true))
+                edges.emplace_back(edge.u + n / 2, edge.v + n / 2, 1);
+            Graph graph(n);
+            graph.addEdges(edges);
+            for (int threads : {1, 4})
+                check_labels(component_labels(graph.freeze(), threads), n, edges);
+        }
+    }
+} // namespace
+
+int main()
+{
+    test_small_graphs();
+    test_giant_component();
+    return GraphTests::result();
+}
@@ -0,0 +1,173 @@
+#include "test_utils.hpp"
+#include "dynamic_connectivity.hpp"
+#include "graph.hpp"
+
+namespace
+{
+    /**
+     * @brief Compare every answer of the structure with a union-find over the current edges
+     */
+    void check_against(const DynamicConnectivity &dc, int n, const std::vector<Edge> &edges, std::uint64_t removed = 0)
+    {
+        std::vector<int> label;
+        CHECK_EQ(dc.componentCount(), GraphTests::brute_components(n, edges, removed, &label));
+        CHECK_EQ(dc.getOrder(), n);
+        CHECK_EQ(dc.getSize(), static_cast<int>(edges.size()));
+        std::vector<int> size(n + 1, 0);
+        for (int v = 1; v <= n; ++v)
+            size[label[v]]++;
+        for (int u = 1; u <= n; ++u)
+        {
+            if (label[u] == 0)
+                continue;
+            CHECK_EQ(dc.componentSize(u), size[label[u]]);
+            for (int v = 1; v <= n; ++v)
+            {
+                if (label[v] != 0)
+                    CHECK_EQ(dc.connected(u, v), label[u] == label[v]);
+            }
+        }
+    }
+
+    // Remove a primeira aresta entre u e v do modelo (em qualquer sentido)
+    bool remove_from_model(std::vector<Edge> &edges, int u, int v)
+    {
+        for (std::size_t i = 0; i < edges.size(); ++i)
+        {
+            if ((edges[i].u == u && edges[i].v == v) || (edges[i].u == v && edges[i].v == u))
+            {
+                edges.erase(edges.begin() + static_cast<long>(i));
+                return true;
+            }
+        }
+        return false;
+    }
+
+    void test_random_updates()
+    {
+        std::mt19937 random(23);
+        for (int round = 0; round < 60; ++round)
+        {
+            int n = 1 + static_cast<int>(random() % 24);
+            DynamicConnectivity dc(n);
+            std::vector<Edge> edges;
+            for (int step = 0; step < 300; ++step)
+            {
+                int operation = static_cast<int>(random() % 100);
+                if (operation < 45 || edges.empty())
+                {
+                    // Arestas paralelas e lacos incluidos
+                    int u = 1 + static_cast<int>(random() % n);
+                    int v = 1 + static_cast<int>(random() % n);
+                    dc.addEdge(u, v);
+                    edges.emplace_back(u, v, 1);
+                }
+                else if (operation < 90)
+                {
+                    // Quase sempre uma aresta existente, as vezes um par qualquer
+                    int u, v;
+                    if (random() % 4 != 0)
+                    {
+                        const Edge &edge = edges[random() % edges.size()];
+                        u = edge.u;
+                        v = edge.v;
+                        if (random() % 2 == 0)
+                            std::swap(u, v);
+                    }
+                    else
+                    {
+                        u = 1 + static_cast<int>(random() % n);
+                        v = 1 + static_cast<int>(random() % n);
+                    }
+                    CHECK_EQ(dc.removeEdge(u, v), remove_from_model(edges, u, v));
+                }
+                else
+                {
+                    CHECK_EQ(dc.addVertex(), ++n);
+                }
+                check_against(dc, n, edges);
+            }
+
+            // Esvazia o grafo: cada vertice volta a ser uma componente
+            while (!edges.empty())
+            {
+                Edge edge = edges[random() % edges.size()];
+                CHECK(dc.removeEdge(edge.u, edge.v));
+                remove_from_model(edges, edge.u, edge.v);
+            }
+            check_against(dc, n, edges);
+        }
+    }
+
+    void test_from_graph()
+    {
+        std::mt19937 random(230);
+        for (int round = 0; round < 60; ++round)
+        {
+            int n = 1 + static_cast<int>(random() % 16);
+            std::vector<Edge> all = GraphTests::random_edges(random, n, static_cast<int>(random() % (2 * n + 1)), 1, true);
+            Graph graph(n);
+            graph.addEdges(all);
+
+            // Vertices removidos nao contam como componentes
+            std::uint64_t removed = 0;
+            for (int i = static_cast<int>(random() % 3); i > 0; --i)
+            {
+                int v = 1 + static_cast<int>(random() % n);
+                graph.removeVertex(v);
+                removed |= std::uint64_t(1) << (v - 1);
+            }
+            std::vector<Edge> edges;
+            for (const Edge &edge : all)
+            {
+                if (((removed >> (edge.u - 1)) & 1) == 0 && ((removed >> (edge.v - 1)) & 1) == 0)
+                    edges.push_back(edge);
+            }
+
+            DynamicConnectivity dc(graph);
+            check_against(dc, n, edges, removed);
+            for (int step = 0; step < 40 && !edges.empty(); ++step)
+            {
+                Edge edge = edges[random() % edges.size()];
+                CHECK(dc.removeEdge(edge.v, edge.u));
+                remove_from_model(edges, edge.u, edge.v);
+                check_against(dc, n, edges, removed);
+            }
+        }
+    }
+
+    void test_long_paths()
+    {
+        // Caminhos longos partidos e religados: as buscas de substituta sobem os niveis
+        std::mt19937 random(2300);
+        int n = 400;
+        DynamicConnectivity dc(n);
+        std::vector<Edge> edges;
+        for (int v = 1; v < n; ++v)
+        {
+            dc.addEdge(v, v + 1);
+            edges.emplace_back(v, v + 1, 1);
+        }
+        for (int step = 0; step < 400; ++step)
+        {
+            int u = 1 + static_cast<int>(random() % n);
+            int v = 1 + static_cast<int>(random() % n);
+            dc.addEdge(u, v);
+            edges.emplace_back(u, v, 1);
+            Edge edge = edges[random() % edges.size()];
+            CHECK(dc.removeEdge(edge.u, edge.v));
+            remove_from_model(edges, edge.u, edge.v);
+            if (step % 20 == 0)
+                check_against(dc, n, edges);
+        }
+        check_against(dc, n, edges);
+    }
+} // namespace
+
+int main()
+{
+    test_random_updates();
+    test_from_graph();
+    test_long_paths();
+    return GraphTests::result();
+}
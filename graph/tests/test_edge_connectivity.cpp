@@ -0,0 +1,92 @@
+#include "test_utils.hpp"
+#include "connected.hpp"
+#include "graph.hpp"
+#include <algorithm>
+#include <climits>
+
+namespace
+{
+    /**
+     * @brief λ by brute force: the fewest edges crossing any split of the vertices in two
+     */
+    int brute_edge_connectivity(int n, const std::vector<Edge> &edges)
+    {
+        if (n < 2)
+            return 0;
+        int best = INT_MAX;
+        for (std::uint64_t side = 1; side + 1 < (std::uint64_t(1) << n); ++side)
+        {
+            int crossing = 0;
+            for (const Edge &edge : edges)
+                crossing += ((side >> (edge.u - 1)) & 1) != ((side >> (edge.v - 1)) & 1);
+            best = std::min(best, crossing);
+        }
+        return best;
+    }
+
+    void test_against_brute_force()
+    {
+        std::mt19937 random(6);
+        for (int round = 0; round < 400; ++round)
+        {
+            int n = 1 + static_cast<int>(random() % 8);
+            std::vector<Edge> edges = GraphTests::random_edges(random, n, static_cast<int>(random() % (3 * n + 1)), 1, true);
+            Graph graph(n);
+            graph.addEdges(edges);
+            int expected = brute_edge_connectivity(n, edges);
+
+            EdgeCut cut = minimum_edge_cut(graph);
+            CHECK_EQ(cut.size, expected);
+            CHECK_EQ(edge_connectivity(graph), expected);
+            CHECK_EQ(minimum_edge_cut(graph.freeze()).size, expected);
+            for (int k = 1; k <= expected + 1; ++k)
+            {
+                CHECK_EQ(is_k_edge_connected(graph, k), expected >= k);
+                CHECK_EQ(is_k_edge_connected(graph.freeze(), k), expected >= k);
+            }
+
+            // O lado devolvido separa o grafo e exatamente cut.size arestas o atravessam
+            if (n >= 2)
+            {
+                std::vector<bool> inSide(n + 1, false);
+                for (int v : cut.side)
+                    inSide[v] = true;
+                CHECK(!cut.side.empty() && static_cast<int>(cut.side.size()) < n);
+                int crossing = 0;
+                for (const Edge &edge : edges)
+                    crossing += inSide[edge.u] != inSide[edge.v];
+                CHECK_EQ(crossing, expected);
+                CHECK_EQ(static_cast<int>(cut.edges.size()), expected);
+                for (const Edge &edge : cut.edges)
+                    CHECK(inSide[edge.u] != inSide[edge.v]);
+            }
+        }
+    }
+
+    void test_known_graphs()
+    {
+        // K5: λ = 4; um ciclo: λ = 2; duas arestas paralelas: λ = 2
+        Graph complete(5);
+        for (int u = 1; u <= 5; ++u)
+            for (int v = u + 1; v <= 5; ++v)
+                complete.addEdge(u, v);
+        CHECK_EQ(edge_connectivity(complete), 4);
+
+        Graph cycle(6);
+        for (int v = 1; v <= 6; ++v)
+            cycle.addEdge(v, v % 6 + 1);
+        CHECK_EQ(edge_connectivity(cycle), 2);
+
+        Graph parallel(2);
+        parallel.addEdge(1, 2);
+        parallel.addEdge(2, 1);
+        CHECK_EQ(edge_connectivity(parallel), 2);
+    }
+} // namespace
+
+int main()
+{
+    test_against_brute_force();
+    test_known_graphs();
+    return GraphTests::result();
+}
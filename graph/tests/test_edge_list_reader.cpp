@@ -0,0 +1,106 @@
+#include "test_utils.hpp"
+#include "edge_list_reader.hpp"
+#include "edge_list_writer.hpp"
+#include <climits>
+#include <sstream>
+
+namespace
+{
+    bool read_text(const std::string &content, EdgeListHeader &header, std::vector<Edge> &edges, bool weighted = true)
+    {
+        GraphTests::write_file("edge_list_reader_case.txt", content);
+        return read_edge_list("edge_list_reader_case.txt", weighted, header, edges);
+    }
+
+    bool same_edges(const std::vector<Edge> &a, const std::vector<Edge> &b)
+    {
+        if (a.size() != b.size())
+            return false;
+        for (std::size_t i = 0; i < a.size(); ++i)
+        {
+            if (a[i].u != b[i].u || a[i].v != b[i].v || a[i].weight != b[i].weight)
+                return false;
+        }
+        return true;
+    }
+
+    void test_valid_files()
+    {
+        EdgeListHeader header;
+        std::vector<Edge> edges;
+
+        CHECK(read_text("3 2\n1 2 5\n2 3 -7", header, edges)); // sem \n no fim
+        CHECK_EQ(header.numVertices, 3);
+        CHECK_EQ(header.numEdges, 2);
+        CHECK(same_edges(edges, {Edge(1, 2, 5), Edge(2, 3, -7)}));
+
+        CHECK(read_text("4 1 1 4\r\n\r\n1 4\r\n", header, edges, false));
+        CHECK_EQ(header.source, 1);
+        CHECK_EQ(header.target, 4);
+        CHECK(same_edges(edges, {Edge(1, 4, 1)}));
+
+        // Limites do int: ainda sao aceitos
+        CHECK(read_text("2147483647 1\n1 2 -2147483648\n", header, edges));
+        CHECK_EQ(header.numVertices, INT_MAX);
+        CHECK_EQ(edges[0].weight, INT_MIN);
+
+        CHECK(read_text("5 0\n", header, edges));
+        CHECK(edges.empty());
+    }
+
+    void test_rejected_files()
+    {
+        EdgeListHeader header;
+        std::vector<Edge> edges;
+
+        CHECK(!read_text("-3 1\n1 2\n", header, edges));
+        CHECK(!read_text("3 -1\n", header, edges));
+        CHECK(!read_text("3 2000000000\n1 2\n", header, edges)); // m muito maior que o arquivo
+        CHECK(!read_text("3 1\n1 99999999999999999999999\n", header, edges));
+        CHECK(!read_text("3 1\n1 2147483648\n", header, edges));
+        CHECK(!read_text("3 1\n1 2 -2147483649\n", header, edges));
+        CHECK(!read_text("4294967298 1\n1 2\n", header, edges)); // daria 2 se o valor desse a volta
+        CHECK(!read_text("3 2\n1 2\n", header, edges));
+        CHECK(!read_text("3 1\n1 x\n", header, edges));
+        CHECK(!read_text("", header, edges));
+        CHECK(!read_edge_list("edge_list_reader_missing.txt", false, header, edges));
+    }
+
+    void test_random_round_trips()
+    {
+        std::mt19937 random(4);
+        for (int round = 0; round < 50; ++round)
+        {
+            int n = 1 + static_cast<int>(random() % 40);
+            std::vector<Edge> expected = GraphTests::random_edges(random, n, static_cast<int>(random() % 80), 1000, true);
+            bool weighted = round % 2 == 0;
+            if (!weighted)
+            {
+                for (Edge &edge : expected)
+                    edge.weight = 1;
+            }
+
+            for (EdgeListFormat format : {EdgeListFormat::Text, EdgeListFormat::Binary})
+            {
+                EdgeListWriter writer;
+                CHECK(writer.open("edge_list_reader_round.bin", format, n, expected.size(), weighted));
+                CHECK(writer.write(expected.data(), expected.size()));
+                CHECK(writer.close());
+
+                EdgeListHeader header;
+                std::vector<Edge> edges;
+                CHECK(read_edge_list("edge_list_reader_round.bin", weighted, header, edges));
+                CHECK_EQ(header.numVertices, n);
+                CHECK(same_edges(edges, expected));
+            }
+        }
+    }
+} // namespace
+
+int main()
+{
+    test_valid_files();
+    test_rejected_files();
+    test_random_round_trips();
+    return GraphTests::result();
+}
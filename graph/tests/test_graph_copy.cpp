@@ -0,0 +1,182 @@
+#include "test_utils.hpp"
+#include "graph.hpp"
+#include <memory>
+
+namespace
+{
+    /**
+     * @brief A graph whose copies share lists (arena) next to a twin whose copies are deep (heap)
+     * Both get the same operations, so they must stay equal list by list.
+     */
+    struct Twin
+    {
+        std::unique_ptr<Graph> shared;
+        std::unique_ptr<Graph> deep;
+    };
+
+    Twin make_twin(int n)
+    {
+        Twin twin;
+        twin.shared.reset(new Graph(n, true));
+        twin.deep.reset(new Graph(n, true, std::unique_ptr<NodeAllocator>(new HeapNodeAllocator())));
+        return twin;
+    }
+
+    Twin copy_twin(const Twin &other)
+    {
+        Twin twin;
+        twin.shared.reset(new Graph(*other.shared));
+        twin.deep.reset(new Graph(*other.deep));
+        return twin;
+    }
+
+    bool same_lists(const Graph &a, const Graph &b)
+    {
+        if (a.getOrder() != b.getOrder())
+            return false;
+        for (int v = 1; v <= a.getOrder(); ++v)
+        {
+            const Node *x = a.getAdjacencyList(v);
+            const Node *y = b.getAdjacencyList(v);
+            for (; x != nullptr && y != nullptr; x = x->next, y = y->next)
+            {
+                if (x->vertex != y->vertex || x->weight != y->weight)
+                    return false;
+            }
+            if (x != y || a.isVertexLive(v) != b.isVertexLive(v) || a.getVertexDegree(v) != b.getVertexDegree(v))
+                return false;
+        }
+        return true;
+    }
+
+    void check_twin(const Twin &twin)
+    {
+        const Graph &a = *twin.shared;
+        const Graph &b = *twin.deep;
+        CHECK_EQ(a.getOrder(), b.getOrder());
+        CHECK_EQ(a.getLiveVertexCount(), b.getLiveVertexCount());
+        CHECK_EQ(a.getSize(), b.getSize());
+        CHECK_EQ(a.getMaxDegree(), b.getMaxDegree());
+        CHECK_EQ(a.getMinDegree(), b.getMinDegree());
+        CHECK(same_lists(a, b));
+    }
+
+    int random_live_vertex(std::mt19937 &random, const Graph &graph)
+    {
+        if (graph.getLiveVertexCount() == 0)
+            return 0;
+        while (true)
+        {
+            int v = 1 + static_cast<int>(random() % graph.getOrder());
+            if (graph.isVertexLive(v))
+                return v;
+        }
+    }
+
+    /**
+     * @brief Random changes, copies, assignments and destructions over a pool of twins
+     */
+    void test_random_operations()
+    {
+        std::mt19937 random(25);
+        for (int round = 0; round < 40; ++round)
+        {
+            std::vector<Twin> pool;
+            pool.push_back(make_twin(1 + static_cast<int>(random() % 12)));
+            for (int step = 0; step < 400; ++step)
+            {
+                Twin &twin = pool[random() % pool.size()];
+                Graph &graph = *twin.shared;
+                int operation = static_cast<int>(random() % 100);
+                if (operation < 35)
+                {
+                    int u = random_live_vertex(random, graph);
+                    int v = random_live_vertex(random, graph);
+                    int weight = 1 + static_cast<int>(random() % 9);
+                    if (u != 0)
+                    {
+                        twin.shared->addEdge(u, v, weight);
+                        twin.deep->addEdge(u, v, weight);
+                    }
+                }
+                else if (operation < 55)
+                {
+                    int u = 1 + static_cast<int>(random() % (graph.getOrder() + 1));
+                    int v = 1 + static_cast<int>(random() % (graph.getOrder() + 1));
+                    CHECK_EQ(twin.shared->removeEdge(u, v), twin.deep->removeEdge(u, v));
+                }
+                else if (operation < 62)
+                {
+                    int v = 1 + static_cast<int>(random() % (graph.getOrder() + 1));
+                    CHECK_EQ(twin.shared->removeVertex(v), twin.deep->removeVertex(v));
+                }
+                else if (operation < 68)
+                {
+                    CHECK_EQ(twin.shared->addVertex(), twin.deep->addVertex());
+                }
+                else if (operation < 72)
+                {
+                    CHECK(twin.shared->compact() == twin.deep->compact());
+                }
+                else if (operation < 84)
+                {
+                    if (pool.size() < 8)
+                        pool.push_back(copy_twin(twin));
+                }
+                else if (operation < 92)
+                {
+                    // Atribuicao (copia) entre dois grafos do pool, possivelmente o mesmo
+                    Twin &other = pool[random() % pool.size()];
+                    *other.shared = *twin.shared;
+                    *other.deep = *twin.deep;
+                }
+                else if (pool.size() > 1)
+                {
+                    // Destroi um grafo qualquer: os nos que ele compartilhava continuam validos
+                    pool.erase(pool.begin() + static_cast<long>(random() % pool.size()));
+                }
+                for (const Twin &each : pool)
+                    check_twin(each);
+            }
+        }
+    }
+
+    void test_copy_chain()
+    {
+        // Copia da copia da copia; o original e os intermediarios morrem antes dos ultimos
+        Twin first = make_twin(6);
+        for (int v = 1; v <= 5; ++v)
+        {
+            first.shared->addEdge(v, v + 1, v);
+            first.deep->addEdge(v, v + 1, v);
+        }
+        std::vector<Twin> chain;
+        chain.push_back(std::move(first));
+        for (int i = 1; i < 6; ++i)
+        {
+            chain.push_back(copy_twin(chain.back()));
+            chain.back().shared->addEdge(i, 6, 10 + i);
+            chain.back().deep->addEdge(i, 6, 10 + i);
+        }
+        for (int i = 0; i < 3; ++i)
+            chain.erase(chain.begin());
+        for (const Twin &twin : chain)
+            check_twin(twin);
+        CHECK_EQ(chain.back().shared->getSize(), 10);
+        CHECK_EQ(chain.front().shared->getSize(), 8);
+
+        // Mover nao copia nada e deixa a origem vazia e utilizavel
+        Graph moved(std::move(*chain.back().shared));
+        CHECK_EQ(moved.getSize(), 10);
+        CHECK_EQ(chain.back().shared->getOrder(), 0);
+        chain.back().shared->addVertex();
+        CHECK_EQ(chain.back().shared->getOrder(), 1);
+    }
+} // namespace
+
+int main()
+{
+    test_random_operations();
+    test_copy_chain();
+    return GraphTests::result();
+}
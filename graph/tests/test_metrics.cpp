@@ -0,0 +1,92 @@
+#include "test_utils.hpp"
+#include "metrics.hpp"
+#include "parallel.hpp"
+#include <thread>
+
+#if GRAPH_METRICS
+namespace
+{
+    GraphMetrics::AlgorithmMetrics find_metrics(const char *name)
+    {
+        for (const GraphMetrics::AlgorithmMetrics &metrics : GraphMetrics::report())
+        {
+            if (metrics.name == name)
+                return metrics;
+        }
+        return GraphMetrics::AlgorithmMetrics();
+    }
+
+    std::uint64_t edges_of(const char *name)
+    {
+        return find_metrics(name).counters[static_cast<int>(GraphMetrics::Counter::EdgesTouched)];
+    }
+
+    void test_workers_charge_the_caller()
+    {
+        // O trabalho das threads do parallel_for entra no escopo aberto na thread que chamou
+        GraphMetrics::reset();
+        {
+            GRAPH_METRICS_SCOPE("test_parallel");
+            parallel_for(0, 100000, 4, [](std::size_t first, std::size_t last, int) {
+                GRAPH_METRICS_ADD(EdgesTouched, last - first);
+            }, 1);
+        }
+        CHECK_EQ(find_metrics("test_parallel").calls, 1u);
+        CHECK_EQ(edges_of("test_parallel"), 100000u);
+        CHECK_EQ(GraphMetrics::totals().counters[static_cast<int>(GraphMetrics::Counter::EdgesTouched)], 100000u);
+    }
+
+    void test_concurrent_scopes()
+    {
+        // Dois algoritmos ao mesmo tempo em threads diferentes nao pagam o trabalho um do outro
+        GraphMetrics::reset();
+        auto run = [](const char *name, int amount) {
+            for (int i = 0; i < 1000; ++i)
+            {
+                GRAPH_METRICS_SCOPE(name);
+                GRAPH_METRICS_ADD(EdgesTouched, amount);
+            }
+        };
+        std::thread first(run, "test_first", 1);
+        std::thread second(run, "test_second", 3);
+        first.join();
+        second.join();
+        CHECK_EQ(find_metrics("test_first").calls, 1000u);
+        CHECK_EQ(edges_of("test_first"), 1000u);
+        CHECK_EQ(find_metrics("test_second").calls, 1000u);
+        CHECK_EQ(edges_of("test_second"), 3000u);
+    }
+
+    void test_nested_scopes()
+    {
+        // Mesmo nome aninhado conta uma chamada; nomes diferentes sao inclusivos
+        GraphMetrics::reset();
+        {
+            GRAPH_METRICS_SCOPE("test_outer");
+            GRAPH_METRICS_ADD(EdgesTouched, 2);
+            {
+                GRAPH_METRICS_SCOPE("test_outer");
+                GRAPH_METRICS_SCOPE("test_inner");
+                GRAPH_METRICS_ADD(EdgesTouched, 5);
+            }
+        }
+        CHECK_EQ(find_metrics("test_outer").calls, 1u);
+        CHECK_EQ(edges_of("test_outer"), 7u);
+        CHECK_EQ(find_metrics("test_inner").calls, 1u);
+        CHECK_EQ(edges_of("test_inner"), 5u);
+
+        GraphMetrics::reset();
+        CHECK(GraphMetrics::report().empty());
+    }
+} // namespace
+#endif
+
+int main()
+{
+#if GRAPH_METRICS
+    test_workers_charge_the_caller();
+    test_concurrent_scopes();
+    test_nested_scopes();
+#endif
+    return GraphTests::result();
+}
@@ -0,0 +1,112 @@
+#include "test_utils.hpp"
+#include "graph.hpp"
+#include "minimum_spanning_tree.hpp"
+#include <climits>
+
+namespace
+{
+    long long total_weight(const std::vector<Edge> &edges)
+    {
+        long long total = 0;
+        for (const Edge &edge : edges)
+            total += edge.weight;
+        return total;
+    }
+
+    bool same_edges(const std::vector<Edge> &a, const std::vector<Edge> &b)
+    {
+        if (a.size() != b.size())
+            return false;
+        for (std::size_t i = 0; i < a.size(); ++i)
+        {
+            if (a[i].u != b[i].u || a[i].v != b[i].v || a[i].weight != b[i].weight)
+                return false;
+        }
+        return true;
+    }
+
+    /**
+     * @brief Weight of a minimum spanning forest by brute force: the lightest subset of edges
+     * that joins the same vertices as the whole graph with n - c edges (so it has no cycle)
+     */
+    long long brute_forest_weight(int n, const std::vector<Edge> &edges)
+    {
+        const int components = GraphTests::brute_components(n, edges);
+        const int m = static_cast<int>(edges.size());
+        long long best = LLONG_MAX;
+        for (std::uint32_t subset = 0; subset < (1u << m); ++subset)
+        {
+            std::vector<Edge> chosen;
+            for (int i = 0; i < m; ++i)
+            {
+                if ((subset >> i) & 1)
+                    chosen.push_back(edges[i]);
+            }
+            if (static_cast<int>(chosen.size()) == n - components &&
+                GraphTests::brute_components(n, chosen) == components)
+                best = std::min(best, total_weight(chosen));
+        }
+        return best;
+    }
+
+    void test_against_brute_force()
+    {
+        std::mt19937 random(12);
+        for (int round = 0; round < 300; ++round)
+        {
+            int n = 1 + static_cast<int>(random() % 6);
+            std::vector<Edge> edges = GraphTests::random_edges(random, n, static_cast<int>(random() % 11), 4, true);
+            Graph graph(n, true);
+            graph.addEdges(edges);
+            long long expected = brute_forest_weight(n, edges);
+
+            CHECK_EQ(total_weight(kruskal_mst(graph)), expected);
+            CHECK_EQ(total_weight(prim_mst(graph)), expected);
+            CHECK_EQ(total_weight(filter_kruskal_mst(graph)), expected);
+            CHECK_EQ(total_weight(boruvka_mst(graph)), expected);
+        }
+    }
+
+    void test_same_tree_as_kruskal()
+    {
+        // Muitos empates de peso: so a ordem total edge_less torna a arvore unica
+        std::mt19937 random(13);
+        for (int round = 0; round < 60; ++round)
+        {
+            int n = 1 + static_cast<int>(random() % 400);
+            int m = static_cast<int>(random() % (4 * n + 1));
+            Graph graph(n, true);
+            graph.addEdges(GraphTests::random_edges(random, n, m, 1 + round % 5, true));
+            std::vector<Edge> expected = kruskal_mst(graph.freeze());
+            CHECK(same_edges(kruskal_mst(graph), expected));
+            for (int threads : {1, 2, 4})
+            {
+                CHECK(same_edges(filter_kruskal_mst(graph, threads), expected));
+                CHECK(same_edges(filter_kruskal_mst(graph.freeze(), threads), expected));
+                CHECK(same_edges(boruvka_mst(graph, threads), expected));
+                CHECK(same_edges(boruvka_mst(graph.freeze(), threads), expected));
+            }
+        }
+
+        // Acima de 2^16 arestas o Filter-Kruskal particiona e filtra em vez de ordenar tudo
+        for (int maxWeight : {3, 100000})
+        {
+            int n = 20000;
+            Graph graph(n, true);
+            graph.addEdges(GraphTests::random_edges(random, n, 150000, maxWeight, true));
+            std::vector<Edge> expected = kruskal_mst(graph.freeze());
+            for (int threads : {1, 4})
+            {
+                CHECK(same_edges(filter_kruskal_mst(graph, threads), expected));
+                CHECK(same_edges(boruvka_mst(graph, threads), expected));
+            }
+        }
+    }
+} // namespace
+
+int main()
+{
+    test_against_brute_force();
+    test_same_tree_as_kruskal();
+    return GraphTests::result();
+}
@@ -0,0 +1,64 @@
+#include "test_utils.hpp"
+#include "graph.hpp"
+#include "query_engine.hpp"
+#include "query_server.hpp"
+#include <sstream>
+
+#if GRAPH_HAS_UNIX_SOCKETS
+#include <fcntl.h>
+#include <unistd.h>
+
+namespace
+{
+    /**
+     * @brief Answers of the text protocol to the given input, read from a file
+     */
+    std::string serve_text(GraphQueryEngine &engine, const std::string &input, QueryServerStats &stats)
+    {
+        GraphTests::write_file("query_server_in.txt", input);
+        int in = ::open("query_server_in.txt", O_RDONLY);
+        int out = ::open("query_server_out.txt", O_WRONLY | O_CREAT | O_TRUNC, 0644);
+        CHECK(serve_stream(engine, in, out, QueryProtocol::Text, stats));
+        ::close(in);
+        ::close(out);
+        std::ifstream answers("query_server_out.txt", std::ios::binary);
+        std::ostringstream text;
+        text << answers.rdbuf();
+        return text.str();
+    }
+
+    void test_long_lines()
+    {
+        Graph graph(3);
+        graph.addEdge(1, 2);
+        GraphQueryEngine engine(graph.freeze());
+
+        // Linhas longas completas, uma atravessando varios blocos de leitura, e outras normais
+        QueryServerStats stats;
+        std::string input = "size 1\n" + std::string(5000, 'x') + "\nsize 3\n" + std::string(300000, 'y') +
+                            "\ncomponents\n" + std::string(4096, ' ') + "size 2\n";
+        CHECK_EQ(serve_text(engine, input, stats), std::string("2\nERR line too long\n1\nERR line too long\n2\n"
+                                                               "ERR line too long\n"));
+        CHECK_EQ(stats.errors, 3u);
+
+        // Linha longa sem '\n' no fim da entrada: um erro so
+        QueryServerStats last;
+        CHECK_EQ(serve_text(engine, "same 1 2\n" + std::string(200000, 'z'), last),
+                 std::string("1\nERR line too long\n"));
+        CHECK_EQ(last.errors, 1u);
+
+        // Linha no limite ainda e respondida
+        QueryServerStats limit;
+        std::string padded = "size 1" + std::string(4096 - 6, ' ');
+        CHECK_EQ(serve_text(engine, padded + "\n" + padded, limit), std::string("2\n2\n"));
+    }
+} // namespace
+#endif
+
+int main()
+{
+#if GRAPH_HAS_UNIX_SOCKETS
+    test_long_lines();
+#endif
+    return GraphTests::result();
+}
@@ -0,0 +1,148 @@
+#include "test_utils.hpp"
+#include "csr_graph.hpp"
+#include "graph.hpp"
+#include "shortest_paths.hpp"
+#include <functional>
+#include <map>
+#include <queue>
+
+namespace
+{
+    typedef std::map<std::pair<int, int>, int> LightestArc;
+
+    /**
+     * @brief Reference Dijkstra: a binary heap with lazy deletion (std::priority_queue)
+     */
+    std::vector<std::int64_t> reference_distances(int n, const std::vector<Edge> &edges, bool directed, int source)
+    {
+        std::vector<std::vector<std::pair<int, int>>> arcs(n + 1);
+        for (const Edge &edge : edges)
+        {
+            arcs[edge.u].emplace_back(edge.v, edge.weight);
+            if (!directed)
+                arcs[edge.v].emplace_back(edge.u, edge.weight);
+        }
+        std::vector<std::int64_t> distance(n + 1, ShortestPaths::UNREACHABLE);
+        typedef std::pair<std::int64_t, int> Entry;
+        std::priority_queue<Entry, std::vector<Entry>, std::greater<Entry>> heap;
+        distance[source] = 0;
+        heap.emplace(0, source);
+        while (!heap.empty())
+        {
+            Entry top = heap.top();
+            heap.pop();
+            if (top.first != distance[top.second])
+                continue;
+            for (const auto &arc : arcs[top.second])
+            {
+                if (top.first + arc.second < distance[arc.first])
+                {
+                    distance[arc.first] = top.first + arc.second;
+                    heap.emplace(distance[arc.first], arc.first);
+                }
+            }
+        }
+        return distance;
+    }
+
+    // Peso da aresta mais leve de u para v (arestas paralelas podem ter pesos diferentes)
+    LightestArc lightest_arcs(const std::vector<Edge> &edges, bool directed)
+    {
+        LightestArc lightest;
+        for (const Edge &edge : edges)
+        {
+            for (int side = 0; side < (directed ? 1 : 2); ++side)
+            {
+                std::pair<int, int> key = side == 0 ? std::make_pair(edge.u, edge.v) : std::make_pair(edge.v, edge.u);
+                auto found = lightest.find(key);
+                if (found == lightest.end() || edge.weight < found->second)
+                    lightest[key] = edge.weight;
+            }
+        }
+        return lightest;
+    }
+
+    /**
+     * @brief path_to(v) goes from the source to v along arcs whose weights add up to distance[v]
+     */
+    void check_path(const ShortestPaths &paths, int v, const LightestArc &lightest)
+    {
+        std::vector<int> path = paths.path_to(v);
+        if (!paths.reached(v))
+        {
+            CHECK(path.empty());
+            return;
+        }
+        CHECK(!path.empty() && path.front() == paths.source && path.back() == v);
+        std::int64_t length = 0;
+        for (std::size_t i = 0; i + 1 < path.size(); ++i)
+        {
+            auto arc = lightest.find(std::make_pair(path[i], path[i + 1]));
+            CHECK(arc != lightest.end());
+            if (arc != lightest.end())
+                length += arc->second;
+        }
+        CHECK_EQ(length, paths.distance[v]);
+    }
+
+    void check_search(const ShortestPaths &paths, int n, const std::vector<std::int64_t> &expected,
+                      const LightestArc &lightest)
+    {
+        CHECK_EQ(static_cast<int>(paths.distance.size()), n + 1);
+        for (int v = 1; v <= n; ++v)
+        {
+            CHECK_EQ(paths.distance[v], expected[v]);
+            CHECK_EQ(paths.reached(v), expected[v] != ShortestPaths::UNREACHABLE);
+            check_path(paths, v, lightest);
+        }
+        // Ids fora de 1..n nao sao vertices
+        CHECK(!paths.reached(0) && paths.path_to(0).empty());
+        CHECK(!paths.reached(n + 1) && paths.path_to(n + 1).empty());
+        CHECK(paths.path_to(-3).empty());
+    }
+
+    void test_against_reference()
+    {
+        std::mt19937 random(10);
+        for (int round = 0; round < 200; ++round)
+        {
+            // Poucas arestas deixam vertices inalcancaveis; pesos 0 e paralelas com pesos diferentes
+            int n = 1 + static_cast<int>(random() % 60);
+            int m = static_cast<int>(random() % (2 * n + 1));
+            std::vector<Edge> edges = GraphTests::random_edges(random, n, m, 20, true);
+            for (Edge &edge : edges)
+                edge.weight -= 1;
+            Graph graph(n, true);
+            graph.addEdges(edges);
+            CsrGraph snapshot = graph.freeze();
+            CsrGraph directed = CsrGraph::arcs(n, edges, true);
+            LightestArc undirectedArcs = lightest_arcs(edges, false);
+            LightestArc directedArcs = lightest_arcs(edges, true);
+
+            for (int source = 1; source <= n; source += 1 + static_cast<int>(random() % 4))
+            {
+                std::vector<std::int64_t> expected = reference_distances(n, edges, false, source);
+                check_search(dijkstra(graph, source), n, expected, undirectedArcs);
+                check_search(dijkstra(snapshot, source), n, expected, undirectedArcs);
+                check_search(dijkstra(directed, source), n, reference_distances(n, edges, true, source), directedArcs);
+
+                // Parando no destino: a distancia e o caminho ate ele ja sao finais
+                int target = 1 + static_cast<int>(random() % n);
+                ShortestPaths early = dijkstra(graph, source, target);
+                CHECK_EQ(early.distance[target], expected[target]);
+                check_path(early, target, undirectedArcs);
+            }
+
+            // Origem inexistente: nada alcancado
+            ShortestPaths none = dijkstra(snapshot, n + 1);
+            for (int v = 1; v <= n; ++v)
+                CHECK(!none.reached(v));
+        }
+    }
+} // namespace
+
+int main()
+{
+    test_against_reference();
+    return GraphTests::result();
+}
@@ -0,0 +1,214 @@
+#include "test_utils.hpp"
+#include "connected.hpp"
+#include "graph.hpp"
+#include <algorithm>
+#include <climits>
+
+namespace
+{
+    bool gone(std::uint64_t removed, int v)
+    {
+        return ((removed >> (v - 1)) & 1) != 0;
+    }
+
+    int popcount(std::uint64_t bits)
+    {
+        int count = 0;
+        for (; bits != 0; bits &= bits - 1)
+            ++count;
+        return count;
+    }
+
+    /**
+     * @brief λ of the live vertices by brute force: the fewest edges crossing a split of them in two
+     */
+    int brute_edge_connectivity(int n, const std::vector<Edge> &edges, std::uint64_t removed)
+    {
+        std::uint64_t all = (std::uint64_t(1) << n) - 1;
+        std::uint64_t liveMask = all & ~removed;
+        if (popcount(liveMask) < 2)
+            return 0;
+        int best = INT_MAX;
+        for (std::uint64_t side = 1; side <= all; ++side)
+        {
+            if ((side & removed) != 0 || side == liveMask)
+                continue;
+            int crossing = 0;
+            for (const Edge &edge : edges)
+                crossing += ((side >> (edge.u - 1)) & 1) != ((side >> (edge.v - 1)) & 1);
+            best = std::min(best, crossing);
+        }
+        return best;
+    }
+
+    /**
+     * @brief κ of the live vertices by brute force (live - 1 if no set of them disconnects the rest)
+     */
+    int brute_vertex_connectivity(int n, const std::vector<Edge> &edges, std::uint64_t removed)
+    {
+        int best = std::max(n - popcount(removed) - 1, 0);
+        for (std::uint64_t cut = 0; cut < (std::uint64_t(1) << n); ++cut)
+        {
+            if ((cut & removed) == 0 && popcount(cut) < best &&
+                GraphTests::brute_components(n, edges, removed | cut) >= 2)
+                best = popcount(cut);
+        }
+        return best;
+    }
+
+    bool brute_complete(int n, const std::vector<Edge> &edges, std::uint64_t removed)
+    {
+        for (int u = 1; u <= n; ++u)
+            for (int v = u + 1; v <= n; ++v)
+            {
+                if (gone(removed, u) || gone(removed, v))
+                    continue;
+                bool adjacent = false;
+                for (const Edge &edge : edges)
+                    adjacent = adjacent || (edge.u == u && edge.v == v) || (edge.u == v && edge.v == u);
+                if (!adjacent)
+                    return false;
+            }
+        return true;
+    }
+
+    // Arestas do grafo como pares ordenados (u <= v), uma por aresta
+    std::vector<std::pair<int, int>> edge_pairs(const Graph &graph)
+    {
+        std::vector<std::pair<int, int>> pairs;
+        for (int u = 1; u <= graph.getOrder(); ++u)
+        {
+            int loops = 0;
+            for (const Node *node = graph.getAdjacencyList(u); node != nullptr; node = node->next)
+            {
+                if (node->vertex > u || (node->vertex == u && loops++ % 2 == 0))
+                    pairs.emplace_back(u, node->vertex);
+            }
+        }
+        std::sort(pairs.begin(), pairs.end());
+        return pairs;
+    }
+
+    void test_against_brute_force()
+    {
+        std::mt19937 random(24);
+        for (int round = 0; round < 400; ++round)
+        {
+            int n = 1 + static_cast<int>(random() % 8);
+            std::vector<Edge> all = GraphTests::random_edges(random, n, static_cast<int>(random() % (3 * n + 1)), 1, true);
+            Graph graph(n);
+            graph.addEdges(all);
+
+            std::uint64_t removed = 0;
+            int removals = static_cast<int>(random() % n);
+            for (int i = 0; i < removals; ++i)
+            {
+                int v = 1 + static_cast<int>(random() % n);
+                CHECK_EQ(graph.removeVertex(v), !gone(removed, v));
+                removed |= std::uint64_t(1) << (v - 1);
+            }
+            std::vector<Edge> edges;
+            for (const Edge &edge : all)
+            {
+                if (!gone(removed, edge.u) && !gone(removed, edge.v))
+                    edges.push_back(edge);
+            }
+            int live = n - popcount(removed);
+
+            CHECK_EQ(graph.getOrder(), n);
+            CHECK_EQ(graph.getLiveVertexCount(), live);
+            CHECK_EQ(graph.getSize(), static_cast<int>(edges.size()));
+            for (int v = 1; v <= n; ++v)
+                CHECK_EQ(graph.isVertexLive(v), !gone(removed, v));
+
+            // Consultas de componentes ignoram os vertices removidos
+            std::vector<int> label;
+            int components = GraphTests::brute_components(n, edges, removed, &label);
+            CHECK_EQ(connected_component_amount(graph), components);
+            CHECK_EQ(is_connected(graph), components <= 1);
+            CHECK_EQ(is_forest(graph), static_cast<int>(edges.size()) == live - components);
+            for (int v = 1; v <= n; ++v)
+            {
+                int size = 0;
+                for (int w = 1; w <= n; ++w)
+                    size += label[v] != 0 && label[w] == label[v];
+                CHECK_EQ(vertices_amount_in_connected_component(graph, v), size);
+            }
+
+            // Cortes e separadores so usam vertices vivos, nos ids do grafo
+            int lambda = brute_edge_connectivity(n, edges, removed);
+            EdgeCut edgeCut = minimum_edge_cut(graph);
+            CHECK_EQ(edgeCut.size, lambda);
+            for (int v : edgeCut.side)
+                CHECK(v >= 1 && v <= n && !gone(removed, v));
+            for (int k = 1; k <= lambda + 1; ++k)
+                CHECK_EQ(is_k_edge_connected(graph, k), lambda >= k);
+
+            int kappa = brute_vertex_connectivity(n, edges, removed);
+            bool complete = brute_complete(n, edges, removed);
+            VertexCut vertexCut = minimum_vertex_separator(graph);
+            CHECK_EQ(vertexCut.size, kappa);
+            CHECK_EQ(is_complete(graph), complete);
+            std::uint64_t separator = 0;
+            for (int v : vertexCut.separator)
+            {
+                CHECK(v >= 1 && v <= n && !gone(removed, v));
+                separator |= std::uint64_t(1) << (v - 1);
+            }
+            if (!complete)
+                CHECK(GraphTests::brute_components(n, edges, removed | separator) >= 2);
+            for (int k = 1; k <= live; ++k)
+                CHECK_EQ(is_k_vertex_connected(graph, k), complete || kappa >= k);
+
+            // compact: os vivos viram 1..live na mesma ordem, com as mesmas arestas
+            std::vector<std::pair<int, int>> before = edge_pairs(graph);
+            std::vector<int> mapping = graph.compact();
+            CHECK_EQ(static_cast<int>(mapping.size()), n + 1);
+            int next = 0;
+            for (int v = 1; v <= n; ++v)
+                CHECK_EQ(mapping[v], gone(removed, v) ? 0 : ++next);
+            CHECK_EQ(graph.getOrder(), live);
+            CHECK_EQ(graph.getLiveVertexCount(), live);
+            CHECK_EQ(graph.getSize(), static_cast<int>(edges.size()));
+            std::vector<std::pair<int, int>> expected;
+            for (const auto &pair : before)
+            {
+                int u = mapping[pair.first];
+                int v = mapping[pair.second];
+                expected.emplace_back(std::min(u, v), std::max(u, v));
+            }
+            std::sort(expected.begin(), expected.end());
+            CHECK(edge_pairs(graph) == expected);
+            CHECK_EQ(connected_component_amount(graph), components);
+            CHECK_EQ(edge_connectivity(graph), lambda);
+        }
+    }
+
+    void test_remove_vertex_keeps_connected()
+    {
+        // Caminho 1-2-3-4: tirar uma ponta deixa o resto conexo
+        Graph graph(4);
+        graph.addEdges({Edge(1, 2, 1), Edge(2, 3, 1), Edge(3, 4, 1)});
+        CHECK(is_connected(graph));
+        CHECK(graph.removeVertex(4));
+        CHECK(is_connected(graph));
+        CHECK_EQ(connected_component_amount(graph), 1);
+        CHECK(is_forest(graph));
+        CHECK_EQ(vertices_amount_in_connected_component(graph, 4), 0);
+        CHECK_EQ(vertices_amount_in_connected_component(graph, 1), 3);
+        CHECK(is_k_edge_connected(graph, 1));
+        CHECK(is_k_vertex_connected(graph, 1));
+
+        // Tirar o meio separa
+        CHECK(graph.removeVertex(2));
+        CHECK(!is_connected(graph));
+        CHECK_EQ(connected_component_amount(graph), 2);
+    }
+} // namespace
+
+int main()
+{
+    test_against_brute_force();
+    test_remove_vertex_keeps_connected();
+    return GraphTests::result();
+}
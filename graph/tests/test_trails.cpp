@@ -0,0 +1,109 @@
+#include "test_utils.hpp"
+#include "graph.hpp"
+#include "trails.hpp"
+#include <algorithm>
+#include <tuple>
+
+namespace
+{
+    typedef std::tuple<int, int, int> EdgeKey;
+
+    std::vector<EdgeKey> edge_keys(const std::vector<Edge> &edges)
+    {
+        std::vector<EdgeKey> keys;
+        for (const Edge &edge : edges)
+            keys.emplace_back(std::min(edge.u, edge.v), std::max(edge.u, edge.v), edge.weight);
+        std::sort(keys.begin(), keys.end());
+        return keys;
+    }
+
+    /**
+     * @brief Edges of a random walk: every vertex it passes has even degree, except its two ends
+     * when the walk is open. Self-loops and parallel edges are drawn often.
+     */
+    std::vector<Edge> random_walk(std::mt19937 &random, int n, int length, bool closed)
+    {
+        std::vector<Edge> edges;
+        int start = 1 + static_cast<int>(random() % n);
+        int current = start;
+        for (int i = 0; i < length; ++i)
+        {
+            int next = random() % 5 == 0 ? current : 1 + static_cast<int>(random() % n);
+            if (closed && i == length - 1)
+                next = start;
+            edges.emplace_back(current, next, 1 + static_cast<int>(random() % 5));
+            current = next;
+        }
+        return edges;
+    }
+
+    /**
+     * @brief The trail is a chain that uses every edge once, from and to the vertices in properties
+     */
+    void check_trail(const std::vector<Edge> &trail, const std::vector<Edge> &edges,
+                     const EulerianTrailProperties &properties)
+    {
+        CHECK_EQ(trail.size(), edges.size());
+        CHECK(edge_keys(trail) == edge_keys(edges));
+        if (trail.empty() || trail.size() != edges.size())
+            return;
+        for (std::size_t i = 0; i + 1 < trail.size(); ++i)
+            CHECK_EQ(trail[i].v, trail[i + 1].u);
+        if (properties.hasTFE)
+        {
+            CHECK_EQ(trail.front().u, properties.startTFE);
+            CHECK_EQ(trail.back().v, properties.startTFE);
+        }
+        else
+        {
+            CHECK_EQ(trail.front().u, properties.startTAE);
+            CHECK_EQ(trail.back().v, properties.endTAE);
+        }
+    }
+
+    void test_eulerian_multigraphs()
+    {
+        std::mt19937 random(8);
+        for (int round = 0; round < 300; ++round)
+        {
+            int n = 1 + static_cast<int>(random() % 10);
+            bool closed = round % 2 == 0;
+            std::vector<Edge> edges = random_walk(random, n, 1 + static_cast<int>(random() % 30), closed);
+            Graph graph(n, true);
+            graph.addEdges(edges);
+
+            EulerianTrailProperties properties = getEulerianPropetiesOfGraph(graph);
+            CHECK(properties.isEulerian);
+            bool odd = edges.front().u != edges.back().v;
+            CHECK_EQ(properties.hasTAE, odd);
+            CHECK_EQ(properties.hasTFE, !odd);
+
+            check_trail(hierholzer_algorithm(graph, properties), edges, properties);
+            check_trail(hierholzer_algorithm(graph.freeze(), properties), edges, properties);
+            check_trail(fleury_algorithm(graph, properties), edges, properties);
+        }
+    }
+
+    void test_not_eulerian()
+    {
+        // Uma estrela com quatro folhas (quatro vertices de grau impar); e duas componentes com arestas
+        Graph star(5);
+        star.addEdges({Edge(1, 2, 1), Edge(1, 3, 1), Edge(1, 4, 1), Edge(1, 5, 1)});
+        EulerianTrailProperties properties = getEulerianPropetiesOfGraph(star);
+        CHECK(!properties.isEulerian);
+        CHECK(hierholzer_algorithm(star, properties).empty());
+
+        Graph split(4);
+        split.addEdges({Edge(1, 2, 1), Edge(2, 1, 1), Edge(3, 4, 1), Edge(4, 3, 1)});
+        properties = getEulerianPropetiesOfGraph(split);
+        CHECK(!properties.isEulerian);
+        CHECK(hierholzer_algorithm(split, properties).empty());
+    }
+} // namespace
+
+int main()
+{
+    test_eulerian_multigraphs();
+    test_not_eulerian();
+    return GraphTests::result();
+}
@@ -0,0 +1,137 @@
+#ifndef TEST_UTILS_HPP
+#define TEST_UTILS_HPP
+
+#include <cstdint>
+#include <fstream>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+#include "myDS.hpp"
+
+using namespace MyDataStructures;
+
+/**
+ * @brief Helpers shared by the ctest executables
+ *
+ * A failed CHECK prints the expression and its location and the test goes on, so one run
+ * reports every failure; main returns GraphTests::result().
+ */
+namespace GraphTests
+{
+
+    inline int &failures()
+    {
+        static int count = 0;
+        return count;
+    }
+
+    inline bool check(bool ok, const char *expression, const char *file, int line)
+    {
+        if (!ok)
+        {
+            std::cerr << file << ":" << line << ": CHECK failed: " << expression << std::endl;
+            failures()++;
+        }
+        return ok;
+    }
+
+    template <typename A, typename B>
+    bool check_equal(const A &a, const B &b, const char *expression, const char *file, int line)
+    {
+        if (a == b)
+            return true;
+        std::cerr << file << ":" << line << ": CHECK_EQ failed: " << expression << " (" << a << " != " << b << ")"
+                  << std::endl;
+        failures()++;
+        return false;
+    }
+
+    /**
+     * @brief Exit status of the test: 0 if every check passed
+     */
+    inline int result()
+    {
+        if (failures() == 0)
+            return 0;
+        std::cerr << failures() << " check(s) failed" << std::endl;
+        return 1;
+    }
+
+    /**
+     * @brief Random multigraph edges (parallel edges and, optionally, self-loops)
+     * @param random Generator of the test
+     * @param vertices Vertices 1..vertices
+     * @param count Number of edges
+     * @param maxWeight Weights are drawn from 1..maxWeight
+     * @param loops Whether self-loops may be drawn
+     */
+    inline std::vector<Edge> random_edges(std::mt19937 &random, int vertices, int count, int maxWeight, bool loops)
+    {
+        std::vector<Edge> edges;
+        while (static_cast<int>(edges.size()) < count && vertices > 0)
+        {
+            int u = 1 + static_cast<int>(random() % vertices);
+            int v = 1 + static_cast<int>(random() % vertices);
+            if (u == v && !loops)
+                continue;
+            edges.emplace_back(u, v, 1 + static_cast<int>(random() % maxWeight));
+        }
+        return edges;
+    }
+
+    /**
+     * @brief Components of the graph left after removing some vertices, by plain union-find
+     * Kept apart from the library so that the brute force checks do not share its code.
+     * @param vertices Vertices 1..vertices
+     * @param edges The edges
+     * @param removed Bit v - 1 set: vertex v is removed
+     * @param label Receives a representative per vertex (0 for removed vertices), if not null
+     * @return Number of components among the vertices left
+     */
+    inline int brute_components(int vertices, const std::vector<Edge> &edges, std::uint64_t removed = 0,
+                                std::vector<int> *label = nullptr)
+    {
+        std::vector<int> parent(vertices + 1);
+        for (int v = 0; v <= vertices; ++v)
+            parent[v] = v;
+        auto find = [&parent](int v) {
+            while (parent[v] != v)
+                v = parent[v] = parent[parent[v]];
+            return v;
+        };
+        auto gone = [removed](int v) { return v <= 64 && ((removed >> (v - 1)) & 1) != 0; };
+        for (const Edge &edge : edges)
+        {
+            if (!gone(edge.u) && !gone(edge.v))
+                parent[find(edge.u)] = find(edge.v);
+        }
+        int count = 0;
+        if (label != nullptr)
+            label->assign(vertices + 1, 0);
+        for (int v = 1; v <= vertices; ++v)
+        {
+            if (gone(v))
+                continue;
+            count += find(v) == v;
+            if (label != nullptr)
+                (*label)[v] = find(v);
+        }
+        return count;
+    }
+
+    /**
+     * @brief Write a file in the working directory of the test (the build directory under ctest)
+     */
+    inline void write_file(const std::string &path, const std::string &content)
+    {
+        std::ofstream out(path, std::ios::binary | std::ios::trunc);
+        out << content;
+    }
+
+} // namespace GraphTests
+
+#define CHECK(...) GraphTests::check((__VA_ARGS__), #__VA_ARGS__, __FILE__, __LINE__)
+#define CHECK_EQ(a, b) GraphTests::check_equal((a), (b), #a " == " #b, __FILE__, __LINE__)
+
+#endif // TEST_UTILS_HPP
@@ -0,0 +1,95 @@
+#include "test_utils.hpp"
+#include "connected.hpp"
+#include "graph.hpp"
+#include <algorithm>
+#include <set>
+
+namespace
+{
+    bool brute_complete(int n, const std::vector<Edge> &edges)
+    {
+        std::set<std::pair<int, int>> pairs;
+        for (const Edge &edge : edges)
+        {
+            if (edge.u != edge.v)
+                pairs.insert(std::make_pair(std::min(edge.u, edge.v), std::max(edge.u, edge.v)));
+        }
+        return static_cast<long long>(pairs.size()) == static_cast<long long>(n) * (n - 1) / 2;
+    }
+
+    /**
+     * @brief κ by brute force: the smallest set of vertices whose removal leaves two or more
+     * components, n - 1 if there is none (every pair is adjacent)
+     */
+    int brute_vertex_connectivity(int n, const std::vector<Edge> &edges)
+    {
+        int best = std::max(n - 1, 0);
+        for (std::uint64_t removed = 0; removed < (std::uint64_t(1) << n); ++removed)
+        {
+            int size = 0;
+            for (std::uint64_t bits = removed; bits != 0; bits &= bits - 1)
+                ++size;
+            if (size < best && GraphTests::brute_components(n, edges, removed) >= 2)
+                best = size;
+        }
+        return best;
+    }
+
+    void test_against_brute_force()
+    {
+        std::mt19937 random(7);
+        for (int round = 0; round < 400; ++round)
+        {
+            int n = 2 + static_cast<int>(random() % 7);
+            int m = static_cast<int>(random() % (n * (n - 1) + 1));
+            std::vector<Edge> edges = GraphTests::random_edges(random, n, m, 1, round % 3 == 0);
+            Graph graph(n);
+            graph.addEdges(edges);
+            int expected = brute_vertex_connectivity(n, edges);
+            bool complete = brute_complete(n, edges);
+
+            VertexCut cut = minimum_vertex_separator(graph);
+            CHECK_EQ(cut.size, expected);
+            CHECK_EQ(vertex_connectivity(graph), expected);
+            CHECK_EQ(minimum_vertex_separator(graph.freeze()).size, expected);
+            CHECK_EQ(is_complete(graph), complete);
+            for (int k = 1; k <= n; ++k)
+            {
+                // Grafos completos sao k-vertice-conexos para todo k
+                CHECK_EQ(is_k_vertex_connected(graph, k), complete || expected >= k);
+                CHECK_EQ(is_k_vertex_connected(graph.freeze(), k), complete || expected >= k);
+            }
+
+            // O separador devolvido desconecta o grafo, e o lado e uma das componentes que sobram
+            if (!complete)
+            {
+                CHECK_EQ(static_cast<int>(cut.separator.size()), expected);
+                std::uint64_t removed = 0;
+                for (int v : cut.separator)
+                    removed |= std::uint64_t(1) << (v - 1);
+                std::vector<int> label;
+                CHECK(GraphTests::brute_components(n, edges, removed, &label) >= 2);
+                CHECK(!cut.side.empty());
+                for (int v : cut.side)
+                    CHECK(label[v] != 0 && label[v] == label[cut.side[0]]);
+            }
+        }
+    }
+
+    void test_multigraph_is_not_complete()
+    {
+        // 3 arestas paralelas em 3 vertices: n(n-1)/2 arestas, mas o vertice 3 esta isolado
+        Graph graph(3);
+        graph.addEdges({Edge(1, 2, 1), Edge(2, 1, 1), Edge(1, 2, 1)});
+        CHECK(!is_complete(graph));
+        CHECK(!is_k_vertex_connected(graph, 1));
+        CHECK_EQ(vertex_connectivity(graph), 0);
+    }
+} // namespace
+
+int main()
+{
+    test_against_brute_force();
+    test_multigraph_is_not_complete();
+    return GraphTests::result();
+}